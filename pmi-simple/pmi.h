@@ -417,6 +417,30 @@ This function gets the value of the specified key in the keyval space.
 int PMI_FUNCTION_ATTRIBUTES PMI_KVS_Get(const char kvsname[], const char key[], char value[],
                                         int length);
 
+/*@
+PMI_KVS_Fence - commit puts, wait for all processes, and fetch keys of a prefix
+
+Input Parameters:
++ kvsname - keyval space name
+- prefix - prefix of the keys to fetch
+
+Return values:
++ PMI_SUCCESS - fence succeeded
+. PMI_ERR_NOMEM - unable to store the fetched keys
+- PMI_FAIL - fence failed
+
+Notes:
+This function is a local extension to PMI-1.  It commits the puts of this
+process and waits until all processes in the process group have called it,
+like 'PMI_KVS_Commit()' followed by 'PMI_Barrier()'.  When the process manager
+supports batched key exchange, the values of all keys in kvsname starting
+with prefix are returned with the fence, and later calls to 'PMI_KVS_Get()'
+for those keys do not contact the process manager.  Otherwise this function
+is exactly 'PMI_KVS_Commit()' followed by 'PMI_Barrier()'.
+
+@*/
+int PMI_FUNCTION_ATTRIBUTES PMI_KVS_Fence(const char kvsname[], const char prefix[]);
+
 /* PMI Process Creation functions */
 
 /*S
@@ -0,0 +1,338 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Measures a startup-style key exchange through the simple PMI client.  The benchmark forks the
+ * client processes itself and serves them as a stand-in process manager over socket pairs, once
+ * with the plain PMI-1 protocol and once with the batched key exchange, and reports the requests
+ * each process sent and the time per exchange.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "pmi.h"
+
+/* Line and pair limits of the simple PMI client */
+#define MAXLINE   1024
+#define MAXPAIRS  30
+#define KVSNAME   "bench-kvs"
+#define VALLENMAX 256
+
+static int nprocs = 8;
+static int nkeys = 4;
+static int vallen = 64;
+static int iterations = 10;
+
+static void make_value(char *value, int iter, int rank, int key)
+{
+    for (int i = 0; i < vallen; i++)
+        value[i] = static_cast<char>('a' + (iter + rank + key + i) % 26);
+    value[vallen] = '\0';
+}
+
+/* ========================================== Client ========================================== */
+
+static int run_client(bool batch)
+{
+    int spawned, rank, size, errors = 0;
+    char kvsname[256], key[64], value[VALLENMAX + 1], expected[VALLENMAX + 1], prefix[64];
+
+    if (PMI_Init(&spawned) != PMI_SUCCESS) return EXIT_FAILURE;
+    PMI_Get_rank(&rank);
+    PMI_Get_size(&size);
+    PMI_KVS_Get_my_name(kvsname, sizeof(kvsname));
+
+    PMI_Barrier();
+    auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < iterations; iter++) {
+        for (int j = 0; j < nkeys; j++) {
+            snprintf(key, sizeof(key), "bench-%d-%d-%d", iter, rank, j);
+            make_value(value, iter, rank, j);
+            if (PMI_KVS_Put(kvsname, key, value) != PMI_SUCCESS) errors++;
+        }
+        snprintf(prefix, sizeof(prefix), "bench-%d-", iter);
+        if (PMI_KVS_Fence(kvsname, prefix) != PMI_SUCCESS) errors++;
+
+        for (int pe = 0; pe < size; pe++) {
+            for (int j = 0; j < nkeys; j++) {
+                snprintf(key, sizeof(key), "bench-%d-%d-%d", iter, pe, j);
+                make_value(expected, iter, pe, j);
+                if (PMI_KVS_Get(kvsname, key, value, sizeof(value)) != PMI_SUCCESS ||
+                    strcmp(value, expected) != 0)
+                    errors++;
+            }
+        }
+        PMI_Barrier();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (rank == 0) {
+        double usec = std::chrono::duration<double, std::micro>(end - start).count();
+        printf("  %-8s %d procs, %d keys of %d bytes per proc: %10.1f us per exchange\n",
+               batch ? "batch" : "plain", size, nkeys, vallen, usec / iterations);
+    }
+    if (errors) fprintf(stderr, "[%d] %d key exchange errors\n", rank, errors);
+
+    PMI_Finalize();
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ===================================== Stand-in server ====================================== */
+
+struct client_t {
+    int fd = -1;
+    std::string inbuf;
+    std::string prefix;
+    bool in_barrier = false;
+    bool in_fence = false;
+    bool done = false;
+};
+
+static std::map<std::string, std::string> parse(const std::string &line)
+{
+    std::map<std::string, std::string> kv;
+    size_t pos = 0;
+    while (pos < line.size()) {
+        size_t end = line.find(' ', pos);
+        if (end == std::string::npos) end = line.size();
+        size_t eq = line.find('=', pos);
+        if (eq != std::string::npos && eq < end)
+            kv[line.substr(pos, eq - pos)] = line.substr(eq + 1, end - eq - 1);
+        pos = end + 1;
+    }
+    return kv;
+}
+
+static void reply(client_t &c, const std::string &line)
+{
+    std::string out = line + "\n";
+    const char *p = out.data();
+    size_t left = out.size();
+    while (left > 0) {
+        ssize_t n = write(c.fd, p, left);
+        if (n <= 0) return;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
+
+/* Answers a fence with every matching key, in lines that fit the client's limits */
+static void reply_fence(client_t &c, const std::map<std::string, std::string> &kvs)
+{
+    std::vector<std::string> chunks;
+    std::vector<int> counts;
+    std::string pairs;
+    int npairs = 0;
+    for (const auto &[key, value] : kvs) {
+        if (key.compare(0, c.prefix.size(), c.prefix) != 0) continue;
+        std::string pair = " key" + std::to_string(npairs) + "=" + key + " value" +
+                           std::to_string(npairs) + "=" + value;
+        if (npairs == MAXPAIRS || pairs.size() + pair.size() > MAXLINE - 64) {
+            chunks.push_back(pairs);
+            counts.push_back(npairs);
+            pairs.clear();
+            npairs = 0;
+            pair = " key0=" + key + " value0=" + value;
+        }
+        pairs += pair;
+        npairs++;
+    }
+    chunks.push_back(pairs);
+    counts.push_back(npairs);
+
+    for (size_t i = 0; i < chunks.size(); i++) {
+        reply(c, "cmd=fence_result rc=0 npairs=" + std::to_string(counts[i]) +
+                     " more=" + (i + 1 < chunks.size() ? "1" : "0") + chunks[i]);
+    }
+}
+
+static void handle(std::vector<client_t> &clients, client_t &c, const std::string &line,
+                   std::map<std::string, std::string> &kvs, bool batch, long &requests)
+{
+    auto kv = parse(line);
+    const std::string &cmd = kv["cmd"];
+    requests++;
+
+    if (cmd == "init") {
+        reply(c, std::string("cmd=response_to_init pmi_version=1 pmi_subversion=1 rc=0") +
+                     (batch ? " batch=1" : ""));
+    } else if (cmd == "get_maxes") {
+        reply(c, "cmd=maxes kvsname_max=256 keylen_max=64 vallen_max=" +
+                     std::to_string(VALLENMAX));
+    } else if (cmd == "get_my_kvsname") {
+        reply(c, "cmd=my_kvsname kvsname=" KVSNAME);
+    } else if (cmd == "put") {
+        kvs[kv["key"]] = kv["value"];
+        reply(c, "cmd=put_result rc=0");
+    } else if (cmd == "mput") {
+        int npairs = atoi(kv["npairs"].c_str());
+        for (int i = 0; i < npairs; i++)
+            kvs[kv["key" + std::to_string(i)]] = kv["value" + std::to_string(i)];
+        reply(c, "cmd=mput_result rc=0");
+    } else if (cmd == "get") {
+        auto it = kvs.find(kv["key"]);
+        if (it == kvs.end())
+            reply(c, "cmd=get_result rc=-1 msg=key_not_found");
+        else
+            reply(c, "cmd=get_result rc=0 value=" + it->second);
+    } else if (cmd == "barrier_in" || cmd == "fence") {
+        c.in_barrier = (cmd == "barrier_in");
+        c.in_fence = (cmd == "fence");
+        c.prefix = kv["prefix"];
+
+        int waiting = 0;
+        for (auto &other : clients)
+            waiting += (other.in_barrier || other.in_fence);
+        if (waiting < static_cast<int>(clients.size())) return;
+
+        for (auto &other : clients) {
+            if (other.in_fence)
+                reply_fence(other, kvs);
+            else
+                reply(other, "cmd=barrier_out");
+            other.in_barrier = other.in_fence = false;
+        }
+    } else if (cmd == "finalize") {
+        reply(c, "cmd=finalize_ack");
+        c.done = true;
+    } else {
+        fprintf(stderr, "stand-in server: unexpected request '%s'\n", line.c_str());
+        c.done = true;
+    }
+}
+
+/* Forks the clients and serves them until they finalize, returning the requests per process */
+static int run_server(bool batch, double *requests_per_proc)
+{
+    std::vector<client_t> clients(nprocs);
+    std::vector<pid_t> pids(nprocs);
+    std::map<std::string, std::string> kvs;
+    long requests = 0;
+    int ret = EXIT_SUCCESS;
+
+    for (int rank = 0; rank < nprocs; rank++) {
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+            perror("socketpair");
+            return EXIT_FAILURE;
+        }
+        pids[rank] = fork();
+        if (pids[rank] < 0) {
+            perror("fork");
+            return EXIT_FAILURE;
+        }
+        if (pids[rank] == 0) {
+            close(sv[0]);
+            for (int i = 0; i < rank; i++)
+                close(clients[i].fd);
+            setenv("PMI_FD", std::to_string(sv[1]).c_str(), 1);
+            setenv("PMI_RANK", std::to_string(rank).c_str(), 1);
+            setenv("PMI_SIZE", std::to_string(nprocs).c_str(), 1);
+            _exit(run_client(batch));
+        }
+        close(sv[1]);
+        clients[rank].fd = sv[0];
+    }
+
+    std::vector<pollfd> fds(nprocs);
+    int active = nprocs;
+    while (active > 0) {
+        for (int i = 0; i < nprocs; i++) {
+            fds[i].fd = clients[i].done ? -1 : clients[i].fd;
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+        if (poll(fds.data(), nprocs, -1) < 0) {
+            perror("poll");
+            ret = EXIT_FAILURE;
+            break;
+        }
+        for (int i = 0; i < nprocs; i++) {
+            if (!(fds[i].revents & (POLLIN | POLLHUP))) continue;
+            char buf[MAXLINE];
+            ssize_t n = read(clients[i].fd, buf, sizeof(buf));
+            if (n <= 0) {
+                clients[i].done = true;
+                active--;
+                continue;
+            }
+            clients[i].inbuf.append(buf, static_cast<size_t>(n));
+            size_t eol;
+            while (!clients[i].done && (eol = clients[i].inbuf.find('\n')) != std::string::npos) {
+                std::string line = clients[i].inbuf.substr(0, eol);
+                clients[i].inbuf.erase(0, eol + 1);
+                handle(clients, clients[i], line, kvs, batch, requests);
+                if (clients[i].done) active--;
+            }
+        }
+    }
+
+    for (int rank = 0; rank < nprocs; rank++) {
+        int status;
+        close(clients[rank].fd);
+        waitpid(pids[rank], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) ret = EXIT_FAILURE;
+    }
+
+    *requests_per_proc = static_cast<double>(requests) / nprocs;
+    return ret;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-n procs] [-k keys] [-v value_bytes] [-i iterations] [-m plain|batch]\n",
+            name);
+}
+
+int main(int argc, char **argv)
+{
+    const char *mode = nullptr;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:k:v:i:m:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                nprocs = atoi(optarg);
+                break;
+            case 'k':
+                nkeys = atoi(optarg);
+                break;
+            case 'v':
+                vallen = atoi(optarg);
+                break;
+            case 'i':
+                iterations = atoi(optarg);
+                break;
+            case 'm':
+                mode = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (nprocs < 1 || nkeys < 1 || iterations < 1 || vallen < 1 || vallen > VALLENMAX ||
+        (mode && strcmp(mode, "plain") != 0 && strcmp(mode, "batch") != 0)) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int ret = EXIT_SUCCESS;
+    for (int batch = 0; batch < 2; batch++) {
+        if (mode && strcmp(mode, batch ? "batch" : "plain") != 0) continue;
+        double requests;
+        fflush(stdout);
+        if (run_server(batch, &requests) != EXIT_SUCCESS) ret = EXIT_FAILURE;
+        printf("  %-8s %.1f requests per proc\n", batch ? "batch" : "plain", requests);
+    }
+    return ret;
+}
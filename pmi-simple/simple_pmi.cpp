@@ -96,8 +96,15 @@ static int PMII_Set_from_port(int, int);
 static int PMII_Connect_to_pm(char *, int);
 
 static int GetResponse(const char[], const char[], int);
+static int ReadResponse(const char[], const char[], int);
 static int getPMIFD(int *);
 
+static int PMII_Batch_put(const char[], const char[], const char[], int *);
+static int PMII_Flush_puts(void);
+static int PMII_Cache_add(const char[], const char[], const char[]);
+static int PMII_Cache_lookup(const char[], const char[], char[], int);
+static void PMII_Cache_free(void);
+
 #ifdef USE_PMI_PORT
 static int PMII_singinit(void);
 static int PMI_totalview = 0;
@@ -109,6 +116,31 @@ static char cached_singinit_key[PMIU_MAXLINE];
 static char cached_singinit_val[PMIU_MAXLINE];
 static char singinit_kvsname[256];
 
+/* Batched key exchange.  A process manager that reports batch=1 in its
+   response to init accepts several key/value pairs per put (cmd=mput) and
+   answers a fence (cmd=fence) with every key of a given prefix, so an
+   exchange of per-process keys costs a few round trips per process instead
+   of one per key.  Puts are held until PMI_KVS_Commit or a full line, and
+   PMI_KVS_Get answers keys returned by the last fence locally.  Setting
+   PMI_BATCH=0 keeps the plain protocol. */
+/* Each pair takes two entries of the 64-entry keyval table of a parsed line */
+#define PMII_BATCH_MAXPAIRS 30
+static int PMI_batch = 0;
+static char PMI_mput_kvsname[PMIU_MAXLINE];
+static char PMI_mput_pairs[PMIU_MAXLINE];
+static int PMI_mput_len = 0;
+static int PMI_mput_npairs = 0;
+
+typedef struct PMII_cache_entry {
+    char *key;
+    char *value;
+} PMII_cache_entry;
+static char PMI_cache_kvsname[PMIU_MAXLINE];
+static PMII_cache_entry *PMI_cache = nullptr;
+static int PMI_cache_count = 0;
+static int PMI_cache_size = 0;
+static int PMI_cache_next = 0;
+
 /******************************** Group functions *************************/
 
 int PMI_Init(int *spawned)
@@ -312,6 +344,7 @@ int PMI_Finalize(void)
         shutdown(PMI_fd, SHUT_RDWR);
         close(PMI_fd);
     }
+    PMII_Cache_free();
 
     return err;
 }
@@ -392,6 +425,12 @@ int PMI_KVS_Put(const char kvsname[], const char key[], const char value[])
         return PMI_SUCCESS;
     }
 
+    if (PMI_batch) {
+        int queued = 0;
+        err = PMII_Batch_put(kvsname, key, value, &queued);
+        if (err != PMI_SUCCESS || queued) return err;
+    }
+
     rc = MPL_snprintf(buf, PMIU_MAXLINE, "cmd=put kvsname=%s key=%s value=%s\n", kvsname, key,
                       value);
     if (rc < 0) return PMI_FAIL;
@@ -401,8 +440,8 @@ int PMI_KVS_Put(const char kvsname[], const char key[], const char value[])
 
 int PMI_KVS_Commit(const char kvsname[] ATTRIBUTE((unused)))
 {
-    /* no-op in this implementation */
-    return PMI_SUCCESS;
+    /* Sends the puts held for batching, and is a no-op otherwise */
+    return PMII_Flush_puts();
 }
 
 /*FIXME: need to return an error if the value returned is truncated
@@ -419,6 +458,12 @@ int PMI_KVS_Get(const char kvsname[], const char key[], char value[], int length
        which MPICH uses PMI, this is where the test needs to be. */
     if (PMIi_InitIfSingleton() != 0) return PMI_FAIL;
 
+    if (PMII_Cache_lookup(kvsname, key, value, length)) return PMI_SUCCESS;
+
+    /* A process may read back its own keys before committing them */
+    err = PMII_Flush_puts();
+    if (err != PMI_SUCCESS) return err;
+
     rc = MPL_snprintf(buf, PMIU_MAXLINE, "cmd=get kvsname=%s key=%s\n", kvsname, key);
     if (rc < 0) return PMI_FAIL;
 
@@ -437,6 +482,53 @@ int PMI_KVS_Get(const char kvsname[], const char key[], char value[], int length
     return err;
 }
 
+int PMI_KVS_Fence(const char kvsname[], const char prefix[])
+{
+    char buf[PMIU_MAXLINE], name[PMIU_IDSIZE];
+    char key[PMIU_MAXLINE], value[PMIU_MAXLINE];
+    int err, rc, i, npairs;
+
+    if (PMI_initialized <= SINGLETON_INIT_BUT_NO_PM) return PMI_SUCCESS;
+
+    if (!PMI_batch) {
+        err = PMI_KVS_Commit(kvsname);
+        if (err != PMI_SUCCESS) return err;
+        return PMI_Barrier();
+    }
+
+    /* Drop the keys of earlier fences, which gets of older keys still find
+       at the process manager, so the cache only holds this fence's keys */
+    PMII_Cache_free();
+
+    err = PMII_Flush_puts();
+    if (err != PMI_SUCCESS) return err;
+
+    rc = MPL_snprintf(buf, PMIU_MAXLINE, "cmd=fence kvsname=%s prefix=%s\n", kvsname, prefix);
+    if (rc < 0 || rc >= PMIU_MAXLINE) return PMI_FAIL;
+
+    /* The process manager replies once every process has entered the fence,
+       with as many lines as the matching keys need, the last one with more=0 */
+    err = GetResponse(buf, "fence_result", 1);
+    while (err == PMI_SUCCESS) {
+        PMIU_getval("npairs", buf, PMIU_MAXLINE);
+        npairs = atoi(buf);
+        for (i = 0; i < npairs && err == PMI_SUCCESS; i++) {
+            MPL_snprintf(name, PMIU_IDSIZE, "key%d", i);
+            if (!PMIU_getval(name, key, PMIU_MAXLINE)) return PMI_FAIL;
+            MPL_snprintf(name, PMIU_IDSIZE, "value%d", i);
+            PMIU_getval(name, value, PMIU_MAXLINE);
+            err = PMII_Cache_add(kvsname, key, value);
+        }
+        if (err != PMI_SUCCESS) break;
+
+        PMIU_getval("more", buf, PMIU_MAXLINE);
+        if (atoi(buf) == 0) break;
+        err = ReadResponse("cmd=fence", "fence_result", 1);
+    }
+
+    return err;
+}
+
 /*************************** Name Publishing functions **********************/
 
 int PMI_Publish_name(const char service_name[], const char port[])
@@ -741,6 +833,11 @@ static int PMII_getmaxes(int *kvsname_max, int *keylen_max, int *vallen_max)
                          PMI_VERSION, PMI_SUBVERSION, buf, buf1);
             PMI_Abort(-1, errmsg);
         }
+        /* Batched key exchange is only used when the process manager offers it */
+        if (PMIU_getval("batch", buf, PMIU_MAXLINE) && atoi(buf) == 1) {
+            char *p = getenv("PMI_BATCH");
+            PMI_batch = (p == nullptr || atoi(p) != 0);
+        }
     }
     err = GetResponse("cmd=get_maxes\n", "maxes", 0);
     if (err == PMI_SUCCESS) {
@@ -767,10 +864,7 @@ static int PMII_getmaxes(int *kvsname_max, int *keylen_max, int *vallen_max)
  */
 static int GetResponse(const char request[], const char expectedCmd[], int checkRc)
 {
-    int err, n;
-    char *p;
-    char recvbuf[PMIU_MAXLINE];
-    char cmdName[PMIU_MAXLINE];
+    int err;
 
     /* FIXME: This is an example of an incorrect fix - writeline can change
        the second argument in some cases, and that will break the const'ness
@@ -780,6 +874,18 @@ static int GetResponse(const char request[], const char expectedCmd[], int check
     if (err) {
         return err;
     }
+    return ReadResponse(request, expectedCmd, checkRc);
+}
+
+/* Reads one response line for request, as GetResponse does after sending it.
+   Commands answered with several lines read the later ones with this */
+static int ReadResponse(const char request[], const char expectedCmd[], int checkRc)
+{
+    int err, n;
+    char *p;
+    char recvbuf[PMIU_MAXLINE];
+    char cmdName[PMIU_MAXLINE];
+
     n = PMIU_readline(PMI_fd, recvbuf, sizeof(recvbuf));
     if (n <= 0) {
         PMIU_printf(1, "readline failed\n");
@@ -810,6 +916,121 @@ static int GetResponse(const char request[], const char expectedCmd[], int check
 
     return err;
 }
+
+/* Holds a put for the next cmd=mput line, sending the pending line first if
+   the pair does not fit.  *queued stays 0 for a pair too long for any mput
+   line, which the caller then sends with a plain put */
+static int PMII_Batch_put(const char kvsname[], const char key[], const char value[], int *queued)
+{
+    char pair[PMIU_MAXLINE];
+    int err, len, room;
+
+    *queued = 0;
+    if (PMI_mput_npairs > 0 && strcmp(kvsname, PMI_mput_kvsname) != 0) {
+        err = PMII_Flush_puts();
+        if (err != PMI_SUCCESS) return err;
+    }
+
+    /* Room left for the pairs after "cmd=mput kvsname=<name> npairs=NN\n" */
+    room = PMIU_MAXLINE - (int) strlen(kvsname) - (int) sizeof("cmd=mput kvsname= npairs=NN\n");
+    len = MPL_snprintf(pair, PMIU_MAXLINE, " key%d=%s value%d=%s", PMI_mput_npairs, key,
+                       PMI_mput_npairs, value);
+    if (len < 0) return PMI_FAIL;
+    if (PMI_mput_npairs == PMII_BATCH_MAXPAIRS || PMI_mput_len + len >= room) {
+        err = PMII_Flush_puts();
+        if (err != PMI_SUCCESS) return err;
+        len = MPL_snprintf(pair, PMIU_MAXLINE, " key0=%s value0=%s", key, value);
+        if (len < 0) return PMI_FAIL;
+    }
+    if (len >= room) return PMI_SUCCESS;
+
+    if (PMI_mput_npairs == 0) MPL_strncpy(PMI_mput_kvsname, kvsname, PMIU_MAXLINE);
+    memcpy(PMI_mput_pairs + PMI_mput_len, pair, len + 1);
+    PMI_mput_len += len;
+    PMI_mput_npairs++;
+    *queued = 1;
+    return PMI_SUCCESS;
+}
+
+static int PMII_Flush_puts(void)
+{
+    char buf[PMIU_MAXLINE];
+    int rc;
+
+    if (PMI_mput_npairs == 0) return PMI_SUCCESS;
+
+    rc = MPL_snprintf(buf, PMIU_MAXLINE, "cmd=mput kvsname=%s npairs=%d%s\n", PMI_mput_kvsname,
+                      PMI_mput_npairs, PMI_mput_pairs);
+    PMI_mput_npairs = 0;
+    PMI_mput_len = 0;
+    PMI_mput_pairs[0] = 0;
+    if (rc < 0 || rc >= PMIU_MAXLINE) return PMI_FAIL;
+
+    return GetResponse(buf, "mput_result", 1);
+}
+
+/* Keys returned by a fence, for one keyval space at a time */
+static int PMII_Cache_add(const char kvsname[], const char key[], const char value[])
+{
+    if (strcmp(kvsname, PMI_cache_kvsname) != 0) {
+        PMII_Cache_free();
+        MPL_strncpy(PMI_cache_kvsname, kvsname, PMIU_MAXLINE);
+    }
+
+    if (PMI_cache_count == PMI_cache_size) {
+        int size = PMI_cache_size ? 2 * PMI_cache_size : 64;
+        PMII_cache_entry *cache =
+            (PMII_cache_entry *) realloc(PMI_cache, sizeof(PMII_cache_entry) * size);
+        if (cache == nullptr) return PMI_ERR_NOMEM;
+        PMI_cache = cache;
+        PMI_cache_size = size;
+    }
+
+    PMI_cache[PMI_cache_count].key = strdup(key);
+    PMI_cache[PMI_cache_count].value = strdup(value);
+    if (PMI_cache[PMI_cache_count].key == nullptr || PMI_cache[PMI_cache_count].value == nullptr) {
+        free(PMI_cache[PMI_cache_count].key);
+        free(PMI_cache[PMI_cache_count].value);
+        return PMI_ERR_NOMEM;
+    }
+    PMI_cache_count++;
+    return PMI_SUCCESS;
+}
+
+/* Processes usually read the keys in the order the fence returned them, so
+   the search starts after the last hit */
+static int PMII_Cache_lookup(const char kvsname[], const char key[], char value[], int length)
+{
+    int i, idx;
+
+    if (PMI_cache_count == 0 || strcmp(kvsname, PMI_cache_kvsname) != 0) return 0;
+
+    for (i = 0; i < PMI_cache_count; i++) {
+        idx = (PMI_cache_next + i) % PMI_cache_count;
+        if (strcmp(PMI_cache[idx].key, key) == 0) {
+            MPL_strncpy(value, PMI_cache[idx].value, length);
+            PMI_cache_next = (idx + 1) % PMI_cache_count;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void PMII_Cache_free(void)
+{
+    int i;
+
+    for (i = 0; i < PMI_cache_count; i++) {
+        free(PMI_cache[i].key);
+        free(PMI_cache[i].value);
+    }
+    free(PMI_cache);
+    PMI_cache = nullptr;
+    PMI_cache_count = 0;
+    PMI_cache_size = 0;
+    PMI_cache_next = 0;
+    PMI_cache_kvsname[0] = 0;
+}
 /* ----------------------------------------------------------------------- */
 
 #ifdef USE_PMI_PORT
@@ -71,6 +71,10 @@ static int sync_cq(ze_command_queue_handle_t &queue,
     size.store(cmd_lists.size());
     cmd_lists.mtx.unlock();
 
+    /* Only NBI command lists are left executing without a host wait, and each is recorded in
+     * cmd_lists, so an empty list means there is nothing to synchronize */
+    if (size.load() == 0) goto fn_exit;
+
     ZE_CHECK(zeCommandQueueSynchronize(queue, UINT64_MAX));
     ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
@@ -88,3 +88,184 @@ ISHMEMI_API_IMPL_TEAM_ALLTOALL(uint32, uint32_t)
 ISHMEMI_API_IMPL_TEAM_ALLTOALL(uint64, uint64_t)
 ISHMEMI_API_IMPL_TEAM_ALLTOALL(size, size_t)
 ISHMEMI_API_IMPL_TEAM_ALLTOALL(ptrdiff, ptrdiff_t)
+
+/* Alltoalls */
+int ishmem_alltoallsmem(void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems)
+{
+    return ishmem_alltoalls((uint8_t *) dest, (uint8_t *) src, dst, sst, nelems);
+}
+
+int ishmem_alltoallsmem(ishmem_team_t team, void *dest, const void *src, ptrdiff_t dst,
+                        ptrdiff_t sst, size_t nelems)
+{
+    return ishmem_alltoalls(team, (uint8_t *) dest, (uint8_t *) src, dst, sst, nelems);
+}
+
+sycl::event ishmemx_alltoallsmem_on_queue(void *dest, const void *src, ptrdiff_t dst,
+                                          ptrdiff_t sst, size_t nelems, int *ret, sycl::queue &q,
+                                          const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoalls_on_queue((uint8_t *) dest, (uint8_t *) src, dst, sst, nelems, ret, q,
+                                      deps);
+}
+
+sycl::event ishmemx_alltoallsmem_on_queue(ishmem_team_t team, void *dest, const void *src,
+                                          ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int *ret,
+                                          sycl::queue &q, const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoalls_on_queue(team, (uint8_t *) dest, (uint8_t *) src, dst, sst, nelems,
+                                      ret, q, deps);
+}
+
+/* Alltoallv */
+int ishmemx_alltoallvmem(void *dest, const size_t *dest_offsets, const void *src,
+                         const size_t *src_offsets, const size_t *src_nelems)
+{
+    return ishmemx_alltoallv((uint8_t *) dest, dest_offsets, (uint8_t *) src, src_offsets,
+                             src_nelems);
+}
+
+int ishmemx_alltoallvmem(ishmem_team_t team, void *dest, const size_t *dest_offsets,
+                         const void *src, const size_t *src_offsets, const size_t *src_nelems)
+{
+    return ishmemx_alltoallv(team, (uint8_t *) dest, dest_offsets, (uint8_t *) src, src_offsets,
+                             src_nelems);
+}
+
+sycl::event ishmemx_alltoallvmem_on_queue(void *dest, const size_t *dest_offsets, const void *src,
+                                          const size_t *src_offsets, const size_t *src_nelems,
+                                          int *ret, sycl::queue &q,
+                                          const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoallv_on_queue((uint8_t *) dest, dest_offsets, (uint8_t *) src,
+                                      src_offsets, src_nelems, ret, q, deps);
+}
+
+sycl::event ishmemx_alltoallvmem_on_queue(ishmem_team_t team, void *dest,
+                                          const size_t *dest_offsets, const void *src,
+                                          const size_t *src_offsets, const size_t *src_nelems,
+                                          int *ret, sycl::queue &q,
+                                          const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoallv_on_queue(team, (uint8_t *) dest, dest_offsets, (uint8_t *) src,
+                                      src_offsets, src_nelems, ret, q, deps);
+}
+
+/* clang-format off */
+#define ISHMEMI_API_IMPL_ALLTOALLS(TYPENAME, TYPE)                                                                                                                                                  \
+    int ishmem_##TYPENAME##_alltoalls(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems) { return ishmem_alltoalls(dest, src, dst, sst, nelems); }                           \
+    sycl::event ishmemx_##TYPENAME##_alltoalls_on_queue(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int *ret, sycl::queue &q, const std::vector<sycl::event> &deps) { \
+        return ishmemx_alltoalls_on_queue(dest, src, dst, sst, nelems, ret, q, deps);                                                                                                               \
+    }
+#define ISHMEMI_API_IMPL_TEAM_ALLTOALLS(TYPENAME, TYPE)                                                                                                                                                                 \
+    int ishmem_##TYPENAME##_alltoalls(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems) { return ishmem_alltoalls(team, dest, src, dst, sst, nelems); }                     \
+    sycl::event ishmemx_##TYPENAME##_alltoalls_on_queue(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int *ret, sycl::queue &q, const std::vector<sycl::event> &deps) { \
+        return ishmemx_alltoalls_on_queue(team, dest, src, dst, sst, nelems, ret, q, deps);                                                                                                                             \
+    }
+#define ISHMEMI_API_IMPL_ALLTOALLV(TYPENAME, TYPE)                                                                                                                                                                                      \
+    int ishmemx_##TYPENAME##_alltoallv(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems) { return ishmemx_alltoallv(dest, dest_offsets, src, src_offsets, src_nelems); }    \
+    sycl::event ishmemx_##TYPENAME##_alltoallv_on_queue(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, int *ret, sycl::queue &q, const std::vector<sycl::event> &deps) { \
+        return ishmemx_alltoallv_on_queue(dest, dest_offsets, src, src_offsets, src_nelems, ret, q, deps);                                                                                                                              \
+    }
+#define ISHMEMI_API_IMPL_TEAM_ALLTOALLV(TYPENAME, TYPE)                                                                                                                                                                                                        \
+    int ishmemx_##TYPENAME##_alltoallv(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems) { return ishmemx_alltoallv(team, dest, dest_offsets, src, src_offsets, src_nelems); } \
+    sycl::event ishmemx_##TYPENAME##_alltoallv_on_queue(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, int *ret, sycl::queue &q, const std::vector<sycl::event> &deps) {    \
+        return ishmemx_alltoallv_on_queue(team, dest, dest_offsets, src, src_offsets, src_nelems, ret, q, deps);                                                                                                                                               \
+    }
+/* clang-format on */
+
+ISHMEMI_API_IMPL_ALLTOALLS(float, float)
+ISHMEMI_API_IMPL_ALLTOALLS(double, double)
+ISHMEMI_API_IMPL_ALLTOALLS(char, char)
+ISHMEMI_API_IMPL_ALLTOALLS(schar, signed char)
+ISHMEMI_API_IMPL_ALLTOALLS(short, short)
+ISHMEMI_API_IMPL_ALLTOALLS(int, int)
+ISHMEMI_API_IMPL_ALLTOALLS(long, long)
+ISHMEMI_API_IMPL_ALLTOALLS(longlong, long long)
+ISHMEMI_API_IMPL_ALLTOALLS(uchar, unsigned char)
+ISHMEMI_API_IMPL_ALLTOALLS(ushort, unsigned short)
+ISHMEMI_API_IMPL_ALLTOALLS(uint, unsigned int)
+ISHMEMI_API_IMPL_ALLTOALLS(ulong, unsigned long)
+ISHMEMI_API_IMPL_ALLTOALLS(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_ALLTOALLS(int8, int8_t)
+ISHMEMI_API_IMPL_ALLTOALLS(int16, int16_t)
+ISHMEMI_API_IMPL_ALLTOALLS(int32, int32_t)
+ISHMEMI_API_IMPL_ALLTOALLS(int64, int64_t)
+ISHMEMI_API_IMPL_ALLTOALLS(uint8, uint8_t)
+ISHMEMI_API_IMPL_ALLTOALLS(uint16, uint16_t)
+ISHMEMI_API_IMPL_ALLTOALLS(uint32, uint32_t)
+ISHMEMI_API_IMPL_ALLTOALLS(uint64, uint64_t)
+ISHMEMI_API_IMPL_ALLTOALLS(size, size_t)
+ISHMEMI_API_IMPL_ALLTOALLS(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(float, float)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(double, double)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(char, char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(schar, signed char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(short, short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(int, int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(long, long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(longlong, long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uchar, unsigned char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(ushort, unsigned short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uint, unsigned int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(ulong, unsigned long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(int8, int8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(int16, int16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(int32, int32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(int64, int64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uint8, uint8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uint16, uint16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uint32, uint32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(uint64, uint64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(size, size_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_ALLTOALLV(float, float)
+ISHMEMI_API_IMPL_ALLTOALLV(double, double)
+ISHMEMI_API_IMPL_ALLTOALLV(char, char)
+ISHMEMI_API_IMPL_ALLTOALLV(schar, signed char)
+ISHMEMI_API_IMPL_ALLTOALLV(short, short)
+ISHMEMI_API_IMPL_ALLTOALLV(int, int)
+ISHMEMI_API_IMPL_ALLTOALLV(long, long)
+ISHMEMI_API_IMPL_ALLTOALLV(longlong, long long)
+ISHMEMI_API_IMPL_ALLTOALLV(uchar, unsigned char)
+ISHMEMI_API_IMPL_ALLTOALLV(ushort, unsigned short)
+ISHMEMI_API_IMPL_ALLTOALLV(uint, unsigned int)
+ISHMEMI_API_IMPL_ALLTOALLV(ulong, unsigned long)
+ISHMEMI_API_IMPL_ALLTOALLV(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_ALLTOALLV(int8, int8_t)
+ISHMEMI_API_IMPL_ALLTOALLV(int16, int16_t)
+ISHMEMI_API_IMPL_ALLTOALLV(int32, int32_t)
+ISHMEMI_API_IMPL_ALLTOALLV(int64, int64_t)
+ISHMEMI_API_IMPL_ALLTOALLV(uint8, uint8_t)
+ISHMEMI_API_IMPL_ALLTOALLV(uint16, uint16_t)
+ISHMEMI_API_IMPL_ALLTOALLV(uint32, uint32_t)
+ISHMEMI_API_IMPL_ALLTOALLV(uint64, uint64_t)
+ISHMEMI_API_IMPL_ALLTOALLV(size, size_t)
+ISHMEMI_API_IMPL_ALLTOALLV(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(float, float)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(double, double)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(char, char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(schar, signed char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(short, short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(int, int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(long, long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(longlong, long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uchar, unsigned char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(ushort, unsigned short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uint, unsigned int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(ulong, unsigned long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(int8, int8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(int16, int16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(int32, int32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(int64, int64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uint8, uint8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uint16, uint16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uint32, uint32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(uint64, uint64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(size, size_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV(ptrdiff, ptrdiff_t)
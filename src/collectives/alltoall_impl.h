@@ -6,10 +6,21 @@
 #define COLLECTIVES_ALLTOALL_IMPL_H
 
 #include "collectives.h"
+#include "ishmem/copy.h"
 #include "sync_impl.h"
 #include "runtime.h"
 #include "on_queue.h"
 
+/* Pairwise exchange schedule: in step k, team PE i sends its block to team PE i ^ k when the team
+ * size is a power of two, and to team PE (i + k) % size otherwise.  Either way, every PE has a
+ * distinct peer in each step, so no link carries more than one block at a time, and the blocks are
+ * copied whole with vector copies */
+ISHMEM_DEVICE_ATTRIBUTES inline int ishmemi_alltoall_peer(int my_pe, int step, int size)
+{
+    if ((size & (size - 1)) == 0) return my_pe ^ step;
+    return (my_pe + step) % size;
+}
+
 /* Alltoall */
 template <typename T>
 int ishmem_alltoall(T *dest, const T *src, size_t nelems)
@@ -38,6 +49,19 @@ int ishmem_alltoall(ishmem_team_t team, T *dest, const T *src, size_t nelems)
 
     /* Node-local, on-device implementation */
     if constexpr (ishmemi_is_device) {
+        ishmemi_info_t *info = global_info;
+        if (team_ptr->only_intra && info->alltoall_schedule == ISHMEMI_ALLTOALL_PAIRWISE &&
+            !ISHMEM_ALLTOALL_CUTOVER) {
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                T *remote = ISHMEMI_FAST_ADJUST(
+                    T, info, local_index, &dest[nelems * static_cast<size_t>(team_ptr->my_pe)]);
+                vec_copy_push(remote, &src[nelems * static_cast<size_t>(peer)], nelems);
+            }
+            ishmemi_team_sync(team); /* assure destination buffers complete */
+            return ret;
+        }
         if (team_ptr->only_intra && !ISHMEM_ALLTOALL_CUTOVER) {
             const T *sptr[MAX_LOCAL_PES]; /* source pointer for each pe */
             T *dptr[MAX_LOCAL_PES];       /* destination pointer for each pe */
@@ -167,6 +191,22 @@ int ishmemx_alltoall_work_group(ishmem_team_t team, T *dest, const T *src, size_
         size_t work_item_start_idx;
         ishmemi_work_item_calculate_offset(nelems, grp, my_nelems_work_item, work_item_start_idx);
         sycl::group_barrier(grp); /* assure source buffers complete on all threads */
+        if (team_ptr->only_intra && info->alltoall_schedule == ISHMEMI_ALLTOALL_PAIRWISE &&
+            !ISHMEM_ALLTOALL_GROUP_CUTOVER) {
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                T *remote = ISHMEMI_FAST_ADJUST(
+                    T, info, local_index, &dest[nelems * static_cast<size_t>(team_ptr->my_pe)]);
+                vec_copy_work_group_push(remote, &src[nelems * static_cast<size_t>(peer)], nelems,
+                                         grp);
+            }
+            /* assure all threads have finished (group barrier)
+             * assure destination buffers complete (sync_all)
+             */
+            ishmemx_team_sync_work_group(team, grp);
+            return ret;
+        }
         if (team_ptr->only_intra && !ISHMEM_ALLTOALL_GROUP_CUTOVER) {
             const T *sptr[MAX_LOCAL_PES]; /* source pointer for each pe */
             T *dptr[MAX_LOCAL_PES];       /* destination pointer for each pe*/
@@ -211,6 +251,378 @@ int ishmemx_alltoall_work_group(ishmem_team_t team, T *dest, const T *src, size_
     }
 }
 
+/* Extent in bytes of nelems elements spaced stride elements apart */
+template <typename T>
+inline size_t ishmemi_alltoalls_extent(size_t nelems, ptrdiff_t stride)
+{
+    return (nelems == 0) ? 0 : ((nelems - 1) * static_cast<size_t>(stride) + 1) * sizeof(T);
+}
+
+/* Alltoalls */
+template <typename T>
+int ishmem_alltoalls(T *dest, const T *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems)
+{
+    int ret = ishmem_alltoalls(ISHMEM_TEAM_WORLD, dest, src, dst, sst, nelems);
+    return ret;
+}
+
+/* Alltoalls on a team */
+template <typename T>
+int ishmem_alltoalls(ishmem_team_t team, T *dest, const T *src, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems)
+{
+    /* Unit strides are a plain alltoall, which has its own fast paths */
+    if (dst == 1 && sst == 1) return ishmem_alltoall(team, dest, src, nelems);
+
+#ifdef __SYCL_DEVICE_ONLY__
+    ishmemi_team_device_t *team_ptr = &global_info->team_device_pool[team];
+#else
+    ishmemi_team_host_t *team_ptr = &ishmemi_cpu_info->team_host_pool[team];
+#endif
+    if constexpr (enable_error_checking) {
+        size_t total_nelems = nelems * static_cast<size_t>(team_ptr->size);
+        validate_parameters((void *) dest, (void *) src,
+                            ishmemi_alltoalls_extent<T>(total_nelems, dst),
+                            ishmemi_alltoalls_extent<T>(total_nelems, sst), ishmemi_op_t::ALLTOALL);
+    }
+
+    int ret = 0;
+
+    /* Node-local, on-device implementation.  There is no cutover: the host has no strided IPC
+     * path, so the proxy could only hand the exchange to the runtime */
+    if constexpr (ishmemi_is_device) {
+        ishmemi_info_t *info = global_info;
+        if (team_ptr->only_intra) {
+            size_t dest_block = nelems * static_cast<size_t>(dst);
+            size_t src_block = nelems * static_cast<size_t>(sst);
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                T *remote = ISHMEMI_FAST_ADJUST(
+                    T, info, local_index, &dest[dest_block * static_cast<size_t>(team_ptr->my_pe)]);
+                stride_copy(remote, &src[src_block * static_cast<size_t>(peer)], dst, sst, nelems);
+            }
+            ishmemi_team_sync(team); /* assure destination buffers complete */
+            return ret;
+        }
+    }
+
+    /* Otherwise */
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nelems;
+    req.dst_stride = dst;
+    req.src_stride = sst;
+    req.op = ALLTOALLS;
+    req.type = ishmemi_union_get_base_type<T, ALLTOALLS>();
+    req.team = team;
+
+#ifdef __SYCL_DEVICE_ONLY__
+    ret = ishmemi_proxy_blocking_request_status(req);
+#else
+    ishmemi_ringcompletion_t comp;
+    ishmemi_runtime->proxy_funcs[req.op][req.type](&req, &comp);
+    ret = ishmemi_proxy_get_status(comp.completion.ret);
+#endif
+    return ret;
+}
+
+template <typename T>
+sycl::event ishmemx_alltoalls_on_queue(ishmem_team_t team, T *dest, const T *src, ptrdiff_t dst,
+                                       ptrdiff_t sst, size_t nelems, int *ret, sycl::queue &q,
+                                       const std::vector<sycl::event> &deps)
+{
+    if (dst == 1 && sst == 1)
+        return ishmemx_alltoall_on_queue(team, dest, src, nelems, ret, q, deps);
+
+    bool entry_already_exists = true;
+    const std::lock_guard<std::mutex> lock(ishmemi_on_queue_events_map.map_mtx);
+    auto iter = ishmemi_on_queue_events_map.get_entry_info(q, entry_already_exists);
+
+    ishmemi_team_host_t *myteam = &ishmemi_cpu_info->team_host_pool[team];
+    auto e = q.submit([&](sycl::handler &cgh) {
+        set_cmd_grp_dependencies(cgh, entry_already_exists, iter->second->event, deps);
+        if ((nelems != 0) && (myteam->only_intra)) {
+            size_t max_work_group_size = iter->second->max_work_group_size;
+            size_t range_size = (nelems < max_work_group_size) ? nelems : max_work_group_size;
+            cgh.parallel_for(
+                sycl::nd_range<1>(sycl::range<1>(range_size), sycl::range<1>(range_size)),
+                [=](sycl::nd_item<1> it) {
+                    int tmp_ret = ishmemx_alltoalls_work_group(team, dest, src, dst, sst, nelems,
+                                                               it.get_group());
+                    if (ret) *ret = tmp_ret;
+                });
+        } else {
+            cgh.single_task([=]() {
+                int tmp_ret = ishmem_alltoalls(team, dest, src, dst, sst, nelems);
+                if (ret) *ret = tmp_ret;
+            });
+        }
+    });
+    ishmemi_on_queue_events_map[&q]->event = e;
+    return e;
+}
+
+template <typename T>
+sycl::event ishmemx_alltoalls_on_queue(T *dest, const T *src, ptrdiff_t dst, ptrdiff_t sst,
+                                       size_t nelems, int *ret, sycl::queue &q,
+                                       const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoalls_on_queue(ISHMEM_TEAM_WORLD, dest, src, dst, sst, nelems, ret, q,
+                                      deps);
+}
+
+/* Alltoalls (work-group) */
+template <typename T, typename Group>
+int ishmemx_alltoalls_work_group(T *dest, const T *src, ptrdiff_t dst, ptrdiff_t sst,
+                                 size_t nelems, const Group &grp)
+{
+    int ret = ishmemx_alltoalls_work_group(ISHMEM_TEAM_WORLD, dest, src, dst, sst, nelems, grp);
+    return ret;
+}
+
+/* Alltoalls (work-group) on a team */
+template <typename T, typename Group>
+int ishmemx_alltoalls_work_group(ishmem_team_t team, T *dest, const T *src, ptrdiff_t dst,
+                                 ptrdiff_t sst, size_t nelems, const Group &grp)
+{
+    if constexpr (ishmemi_is_device) {
+        if (dst == 1 && sst == 1) return ishmemx_alltoall_work_group(team, dest, src, nelems, grp);
+
+        ishmemi_info_t *info = global_info;
+        ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+        if constexpr (enable_error_checking) {
+            size_t total_nelems = nelems * static_cast<size_t>(team_ptr->size);
+            if (grp.leader())
+                validate_parameters((void *) dest, (void *) src,
+                                    ishmemi_alltoalls_extent<T>(total_nelems, dst),
+                                    ishmemi_alltoalls_extent<T>(total_nelems, sst),
+                                    ishmemi_op_t::ALLTOALL);
+        }
+        int ret = 0;
+        sycl::group_barrier(grp); /* assure source buffers complete on all threads */
+        if (team_ptr->only_intra) {
+            size_t dest_block = nelems * static_cast<size_t>(dst);
+            size_t src_block = nelems * static_cast<size_t>(sst);
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                T *remote = ISHMEMI_FAST_ADJUST(
+                    T, info, local_index, &dest[dest_block * static_cast<size_t>(team_ptr->my_pe)]);
+                stride_copy_work_group(remote, &src[src_block * static_cast<size_t>(peer)], dst,
+                                       sst, nelems, grp);
+            }
+            /* assure all threads have finished (group barrier)
+             * assure destination buffers complete (sync_all)
+             */
+            ishmemx_team_sync_work_group(team, grp);
+            return ret;
+        } else {
+            if (grp.leader()) {
+                ishmemi_request_t req;
+                req.src = src;
+                req.dst = dest;
+                req.nelems = nelems;
+                req.dst_stride = dst;
+                req.src_stride = sst;
+                req.op = ALLTOALLS;
+                req.type = ishmemi_union_get_base_type<T, ALLTOALLS>();
+                req.team = team;
+
+                ret = ishmemi_proxy_blocking_request_status(req);
+            }
+        }
+        ret = sycl::group_broadcast(grp, ret, 0);
+        return ret;
+    } else {
+        ISHMEM_ERROR_MSG("ISHMEMX_ALLTOALLS_WORK_GROUP routines are not callable from host\n");
+        return -1;
+    }
+}
+
+/* Alltoallv: this PE sends src_nelems[j] elements starting at src[src_offsets[j]] to the team PE
+ * j, where they land at dest[dest_offsets[i]] on PE j, i being this PE's index in the team.  The
+ * offsets are read by the sending PE, so dest_offsets must be symmetric */
+template <typename T>
+int ishmemx_alltoallv(T *dest, const size_t *dest_offsets, const T *src, const size_t *src_offsets,
+                      const size_t *src_nelems)
+{
+    int ret =
+        ishmemx_alltoallv(ISHMEM_TEAM_WORLD, dest, dest_offsets, src, src_offsets, src_nelems);
+    return ret;
+}
+
+/* Alltoallv on a team */
+template <typename T>
+int ishmemx_alltoallv(ishmem_team_t team, T *dest, const size_t *dest_offsets, const T *src,
+                      const size_t *src_offsets, const size_t *src_nelems)
+{
+#ifdef __SYCL_DEVICE_ONLY__
+    ishmemi_team_device_t *team_ptr = &global_info->team_device_pool[team];
+#else
+    ishmemi_team_host_t *team_ptr = &ishmemi_cpu_info->team_host_pool[team];
+#endif
+    if constexpr (enable_error_checking) {
+        validate_parameters((void *) dest_offsets,
+                            sizeof(size_t) * static_cast<size_t>(team_ptr->size));
+    }
+
+    int ret = 0;
+
+    /* Node-local, on-device implementation */
+    if constexpr (ishmemi_is_device) {
+        ishmemi_info_t *info = global_info;
+        if (team_ptr->only_intra) {
+            /* every peer's dest_offsets must be set before they are read */
+            ishmemi_team_sync(team);
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                const size_t *remote_offsets =
+                    ISHMEMI_FAST_ADJUST(const size_t, info, local_index, dest_offsets);
+                T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index,
+                                                &dest[remote_offsets[team_ptr->my_pe]]);
+                vec_copy_push(remote, &src[src_offsets[peer]], src_nelems[peer]);
+            }
+            ishmemi_team_sync(team); /* assure destination buffers complete */
+            return ret;
+        }
+    }
+
+    /* Otherwise */
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.src_nelems = src_nelems;
+    req.dest_offsets = dest_offsets;
+    req.src_offsets = src_offsets;
+    req.op = ALLTOALLV;
+    req.type = ishmemi_union_get_base_type<T, ALLTOALLV>();
+    req.team = team;
+
+#ifdef __SYCL_DEVICE_ONLY__
+    ret = ishmemi_proxy_blocking_request_status(req);
+#else
+    ishmemi_ringcompletion_t comp;
+    ishmemi_runtime->proxy_funcs[req.op][req.type](&req, &comp);
+    ret = ishmemi_proxy_get_status(comp.completion.ret);
+#endif
+    return ret;
+}
+
+template <typename T>
+sycl::event ishmemx_alltoallv_on_queue(ishmem_team_t team, T *dest, const size_t *dest_offsets,
+                                       const T *src, const size_t *src_offsets,
+                                       const size_t *src_nelems, int *ret, sycl::queue &q,
+                                       const std::vector<sycl::event> &deps)
+{
+    bool entry_already_exists = true;
+    const std::lock_guard<std::mutex> lock(ishmemi_on_queue_events_map.map_mtx);
+    auto iter = ishmemi_on_queue_events_map.get_entry_info(q, entry_already_exists);
+
+    ishmemi_team_host_t *myteam = &ishmemi_cpu_info->team_host_pool[team];
+    auto e = q.submit([&](sycl::handler &cgh) {
+        set_cmd_grp_dependencies(cgh, entry_already_exists, iter->second->event, deps);
+        if (myteam->only_intra) {
+            size_t range_size = iter->second->max_work_group_size;
+            cgh.parallel_for(
+                sycl::nd_range<1>(sycl::range<1>(range_size), sycl::range<1>(range_size)),
+                [=](sycl::nd_item<1> it) {
+                    int tmp_ret = ishmemx_alltoallv_work_group(team, dest, dest_offsets, src,
+                                                               src_offsets, src_nelems,
+                                                               it.get_group());
+                    if (ret) *ret = tmp_ret;
+                });
+        } else {
+            cgh.single_task([=]() {
+                int tmp_ret =
+                    ishmemx_alltoallv(team, dest, dest_offsets, src, src_offsets, src_nelems);
+                if (ret) *ret = tmp_ret;
+            });
+        }
+    });
+    ishmemi_on_queue_events_map[&q]->event = e;
+    return e;
+}
+
+template <typename T>
+sycl::event ishmemx_alltoallv_on_queue(T *dest, const size_t *dest_offsets, const T *src,
+                                       const size_t *src_offsets, const size_t *src_nelems,
+                                       int *ret, sycl::queue &q,
+                                       const std::vector<sycl::event> &deps)
+{
+    return ishmemx_alltoallv_on_queue(ISHMEM_TEAM_WORLD, dest, dest_offsets, src, src_offsets,
+                                      src_nelems, ret, q, deps);
+}
+
+/* Alltoallv (work-group) */
+template <typename T, typename Group>
+int ishmemx_alltoallv_work_group(T *dest, const size_t *dest_offsets, const T *src,
+                                 const size_t *src_offsets, const size_t *src_nelems,
+                                 const Group &grp)
+{
+    int ret = ishmemx_alltoallv_work_group(ISHMEM_TEAM_WORLD, dest, dest_offsets, src, src_offsets,
+                                           src_nelems, grp);
+    return ret;
+}
+
+/* Alltoallv (work-group) on a team */
+template <typename T, typename Group>
+int ishmemx_alltoallv_work_group(ishmem_team_t team, T *dest, const size_t *dest_offsets,
+                                 const T *src, const size_t *src_offsets, const size_t *src_nelems,
+                                 const Group &grp)
+{
+    if constexpr (ishmemi_is_device) {
+        ishmemi_info_t *info = global_info;
+        ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+        if constexpr (enable_error_checking) {
+            if (grp.leader())
+                validate_parameters((void *) dest_offsets,
+                                    sizeof(size_t) * static_cast<size_t>(team_ptr->size));
+        }
+        int ret = 0;
+        if (team_ptr->only_intra) {
+            /* assure source buffers complete on all threads and every peer's dest_offsets set */
+            ishmemx_team_sync_work_group(team, grp);
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size);
+                uint8_t local_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, peer)];
+                const size_t *remote_offsets =
+                    ISHMEMI_FAST_ADJUST(const size_t, info, local_index, dest_offsets);
+                T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index,
+                                                &dest[remote_offsets[team_ptr->my_pe]]);
+                vec_copy_work_group_push(remote, &src[src_offsets[peer]], src_nelems[peer], grp);
+            }
+            /* assure all threads have finished (group barrier)
+             * assure destination buffers complete (sync_all)
+             */
+            ishmemx_team_sync_work_group(team, grp);
+            return ret;
+        } else {
+            sycl::group_barrier(grp); /* assure source buffers complete on all threads */
+            if (grp.leader()) {
+                ishmemi_request_t req;
+                req.src = src;
+                req.dst = dest;
+                req.src_nelems = src_nelems;
+                req.dest_offsets = dest_offsets;
+                req.src_offsets = src_offsets;
+                req.op = ALLTOALLV;
+                req.type = ishmemi_union_get_base_type<T, ALLTOALLV>();
+                req.team = team;
+
+                ret = ishmemi_proxy_blocking_request_status(req);
+            }
+        }
+        ret = sycl::group_broadcast(grp, ret, 0);
+        return ret;
+    } else {
+        ISHMEM_ERROR_MSG("ISHMEMX_ALLTOALLV_WORK_GROUP routines are not callable from host\n");
+        return -1;
+    }
+}
+
 /* clang-format off */
 template int ishmemx_alltoallmem_work_group<sycl::group<1>>(void *dest, const void *src, size_t nelems, const sycl::group<1> &grp);
 template int ishmemx_alltoallmem_work_group<sycl::group<2>>(void *dest, const void *src, size_t nelems, const sycl::group<2> &grp);
@@ -301,4 +713,186 @@ ISHMEMI_API_IMPL_TEAM_ALLTOALL_WORK_GROUP(uint64, uint64_t)
 ISHMEMI_API_IMPL_TEAM_ALLTOALL_WORK_GROUP(size, size_t)
 ISHMEMI_API_IMPL_TEAM_ALLTOALL_WORK_GROUP(ptrdiff, ptrdiff_t)
 
+/* clang-format off */
+template int ishmemx_alltoallsmem_work_group<sycl::group<1>>(void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<1> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::group<2>>(void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<2> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::group<3>>(void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<3> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::sub_group>(void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::sub_group &grp);
+
+template int ishmemx_alltoallsmem_work_group<sycl::group<1>>(ishmem_team_t team, void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<1> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::group<2>>(ishmem_team_t team, void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<2> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::group<3>>(ishmem_team_t team, void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<3> &grp);
+template int ishmemx_alltoallsmem_work_group<sycl::sub_group>(ishmem_team_t team, void *dest, const void *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::sub_group &grp);
+
+template int ishmemx_alltoallvmem_work_group<sycl::group<1>>(void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<1> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::group<2>>(void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<2> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::group<3>>(void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<3> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::sub_group>(void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::sub_group &grp);
+
+template int ishmemx_alltoallvmem_work_group<sycl::group<1>>(ishmem_team_t team, void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<1> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::group<2>>(ishmem_team_t team, void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<2> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::group<3>>(ishmem_team_t team, void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<3> &grp);
+template int ishmemx_alltoallvmem_work_group<sycl::sub_group>(ishmem_team_t team, void *dest, const size_t *dest_offsets, const void *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::sub_group &grp);
+/* clang-format on */
+
+template <typename Group>
+inline int ishmemx_alltoallsmem_work_group(void *dest, const void *src, ptrdiff_t dst,
+                                           ptrdiff_t sst, size_t nelems, const Group &grp)
+{
+    return ishmemx_alltoalls_work_group((uint8_t *) dest, (uint8_t *) src, dst, sst, nelems, grp);
+}
+
+template <typename Group>
+inline int ishmemx_alltoallsmem_work_group(ishmem_team_t team, void *dest, const void *src,
+                                           ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                                           const Group &grp)
+{
+    return ishmemx_alltoalls_work_group(team, (uint8_t *) dest, (uint8_t *) src, dst, sst, nelems,
+                                        grp);
+}
+
+template <typename Group>
+inline int ishmemx_alltoallvmem_work_group(void *dest, const size_t *dest_offsets, const void *src,
+                                           const size_t *src_offsets, const size_t *src_nelems,
+                                           const Group &grp)
+{
+    return ishmemx_alltoallv_work_group((uint8_t *) dest, dest_offsets, (uint8_t *) src,
+                                        src_offsets, src_nelems, grp);
+}
+
+template <typename Group>
+inline int ishmemx_alltoallvmem_work_group(ishmem_team_t team, void *dest,
+                                           const size_t *dest_offsets, const void *src,
+                                           const size_t *src_offsets, const size_t *src_nelems,
+                                           const Group &grp)
+{
+    return ishmemx_alltoallv_work_group(team, (uint8_t *) dest, dest_offsets, (uint8_t *) src,
+                                        src_offsets, src_nelems, grp);
+}
+
+/* clang-format off */
+#define ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(TYPENAME, TYPE)                                                                                                                      \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<1>>(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<1> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<2>>(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<2> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<3>>(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<3> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::sub_group>(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::sub_group &grp); \
+    template <typename Group> int ishmemx_##TYPENAME##_alltoalls_work_group(TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const Group &grp) { return ishmemx_alltoalls_work_group(dest, src, dst, sst, nelems, grp); }
+
+#define ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(TYPENAME, TYPE)                                                                                                                                     \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<1>>(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<1> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<2>>(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<2> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::group<3>>(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::group<3> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoalls_work_group<sycl::sub_group>(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const sycl::sub_group &grp); \
+    template <typename Group> int ishmemx_##TYPENAME##_alltoalls_work_group(ishmem_team_t team, TYPE *dest, const TYPE *src, ptrdiff_t dst, ptrdiff_t sst, size_t nelems, const Group &grp) { return ishmemx_alltoalls_work_group(team, dest, src, dst, sst, nelems, grp); }
+
+#define ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(TYPENAME, TYPE)                                                                                                                                                          \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<1>>(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<1> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<2>>(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<2> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<3>>(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<3> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::sub_group>(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::sub_group &grp); \
+    template <typename Group> int ishmemx_##TYPENAME##_alltoallv_work_group(TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const Group &grp) { return ishmemx_alltoallv_work_group(dest, dest_offsets, src, src_offsets, src_nelems, grp); }
+
+#define ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(TYPENAME, TYPE)                                                                                                                                                                         \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<1>>(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<1> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<2>>(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<2> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::group<3>>(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::group<3> &grp);   \
+    template int ishmemx_##TYPENAME##_alltoallv_work_group<sycl::sub_group>(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const sycl::sub_group &grp); \
+    template <typename Group> int ishmemx_##TYPENAME##_alltoallv_work_group(ishmem_team_t team, TYPE *dest, const size_t *dest_offsets, const TYPE *src, const size_t *src_offsets, const size_t *src_nelems, const Group &grp) { return ishmemx_alltoallv_work_group(team, dest, dest_offsets, src, src_offsets, src_nelems, grp); }
+/* clang-format on */
+
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(float, float)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(double, double)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(char, char)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(schar, signed char)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(short, short)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(int, int)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(long, long)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(longlong, long long)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uchar, unsigned char)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(ushort, unsigned short)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uint, unsigned int)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(ulong, unsigned long)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(int8, int8_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(int16, int16_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(int32, int32_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(int64, int64_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uint8, uint8_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uint16, uint16_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uint32, uint32_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(uint64, uint64_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(size, size_t)
+ISHMEMI_API_IMPL_ALLTOALLS_WORK_GROUP(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(float, float)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(double, double)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(char, char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(schar, signed char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(short, short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(int, int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(long, long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(longlong, long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uchar, unsigned char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(ushort, unsigned short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uint, unsigned int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(ulong, unsigned long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(int8, int8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(int16, int16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(int32, int32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(int64, int64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uint8, uint8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uint16, uint16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uint32, uint32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(uint64, uint64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(size, size_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLS_WORK_GROUP(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(float, float)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(double, double)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(char, char)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(schar, signed char)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(short, short)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(int, int)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(long, long)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(longlong, long long)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uchar, unsigned char)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(ushort, unsigned short)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uint, unsigned int)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(ulong, unsigned long)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(int8, int8_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(int16, int16_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(int32, int32_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(int64, int64_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uint8, uint8_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uint16, uint16_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uint32, uint32_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(uint64, uint64_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(size, size_t)
+ISHMEMI_API_IMPL_ALLTOALLV_WORK_GROUP(ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(float, float)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(double, double)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(char, char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(schar, signed char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(short, short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(int, int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(long, long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(longlong, long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uchar, unsigned char)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(ushort, unsigned short)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uint, unsigned int)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(ulong, unsigned long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(int8, int8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(int16, int16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(int32, int32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(int64, int64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uint8, uint8_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uint16, uint16_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uint32, uint32_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(uint64, uint64_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(size, size_t)
+ISHMEMI_API_IMPL_TEAM_ALLTOALLV_WORK_GROUP(ptrdiff, ptrdiff_t)
 #endif  // COLLECTIVES_ALLTOALL_IMPL.H
@@ -16,9 +16,11 @@ void ishmem_barrier_all()
     req.op = BARRIER;
 #ifdef __SYCL_DEVICE_ONLY__
     ishmemi_info_t *info = global_info;
-    if (info->only_intra_node) req.op = QUIET;
+    /* With IPC syncs, the barrier is a quiet followed by a sync */
+    bool ipc_sync = info->only_intra_node || ishmemi_team_is_hierarchical(info, ISHMEM_TEAM_WORLD);
+    if (ipc_sync) req.op = QUIET;
     ishmemi_proxy_blocking_request(req);
-    if (info->only_intra_node) {
+    if (ipc_sync) {
         ishmemi_team_sync(ISHMEM_TEAM_WORLD);
     }
 #else
@@ -14,6 +14,207 @@
 #define BROADCAST_PUSH 0
 #define BROADCAST_PULL 1
 
+/* Hierarchical broadcast on ISHMEM_TEAM_WORLD: the leader of PE_root's node pulls the data over
+ * IPC, the node leaders broadcast it through the runtime, and each node pulls it from its leader */
+template <typename T>
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_broadcast_hierarchical(T *dest, const T *src, size_t nelems,
+                                                            int PE_root)
+{
+    int ret = 0;
+    ishmemi_info_t *info = global_info;
+    ishmemi_team_device_t *node_ptr = &info->team_device_pool[ISHMEMX_TEAM_NODE];
+    int node_size = node_ptr->size;
+    int my_pe = node_ptr->start + node_ptr->my_pe;
+
+    ishmemi_team_sync_intra(info, node_ptr); /* make sure that PE_root's source buffer is ready */
+    if (node_ptr->my_pe == 0) {
+        const T *leader_src = src;
+        if (PE_root / node_size == my_pe / node_size && PE_root != my_pe) {
+            ishmem_internal_get(dest, src, nelems, PE_root);
+            leader_src = dest;
+        }
+
+        ishmemi_request_t req;
+        req.root = PE_root / node_size;
+        req.src = leader_src;
+        req.dst = dest;
+        req.nelems = nelems * sizeof(T);
+        req.op = BCAST;
+        req.type = UINT8;
+        req.team = info->leader_team;
+#ifdef __SYCL_DEVICE_ONLY__
+        ret = ishmemi_proxy_blocking_request_status(req);
+#endif
+    }
+    /* assure the leader's destination buffer is complete */
+    ishmemi_team_sync_intra(info, node_ptr);
+    if (node_ptr->my_pe != 0) ishmem_internal_get(dest, dest, nelems, node_ptr->start);
+    ishmemi_team_sync_intra(info, node_ptr); /* let the leader know we are done */
+    return ret;
+}
+
+/* Pipelined chain broadcast for large intra-node messages.  The team PEs form a chain that starts
+ * at PE_root, and each PE forwards every chunk to the next PE of the chain as soon as the chunk has
+ * arrived, so all the links of the chain carry data at once.  After forwarding a chunk, a PE writes
+ * the running count of chunks into the bcast_ready signal of the next PE (see teams.h), and PE_root
+ * also copies the chunk into its own destination.  With teams of two PEs, pipelining has nothing
+ * to overlap */
+ISHMEM_DEVICE_ATTRIBUTES inline bool ishmemi_broadcast_use_pipeline(int team_size, size_t nbytes,
+                                                                    size_t cutover)
+{
+    return (team_size > 2) && (nbytes >= cutover);
+}
+
+template <typename T>
+ISHMEM_DEVICE_ATTRIBUTES inline size_t ishmemi_broadcast_chunk_nelems(size_t chunk_bytes)
+{
+    return (chunk_bytes < sizeof(T)) ? 1 : (chunk_bytes / sizeof(T));
+}
+
+template <typename T>
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_broadcast_pipelined(ishmemi_info_t *info,
+                                                         ishmemi_team_device_t *team_ptr, T *dest,
+                                                         const T *src, size_t nelems, int PE_root)
+{
+    size_t chunk = ishmemi_broadcast_chunk_nelems<T>(info->bcast_pipeline_chunk);
+    long nchunks = static_cast<long>((nelems + chunk - 1) / chunk);
+    long base = team_ptr->bcast_chunks;
+    team_ptr->bcast_chunks = base + nchunks;
+
+    int next_idx = (team_ptr->my_pe + 1) % team_ptr->size;
+    bool is_root = (team_ptr->my_pe == PE_root);
+    bool is_last = (next_idx == PE_root);
+    const T *from = is_root ? src : dest;
+    uint8_t next_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, next_idx)];
+    T *next_dest = ISHMEMI_FAST_ADJUST(T, info, next_index, dest);
+    long *next_ready = ISHMEMI_FAST_ADJUST(long, info, next_index, &team_ptr->bcast_ready);
+
+    sycl::atomic_ref<long, sycl::memory_order::acq_rel, sycl::memory_scope::system,
+                     sycl::access::address_space::global_space>
+        atomic_ready(team_ptr->bcast_ready);
+    sycl::atomic_ref<long, sycl::memory_order::seq_cst, sycl::memory_scope::system,
+                     sycl::access::address_space::global_space>
+        atomic_next_ready(*next_ready);
+
+    /* assure that PE_root's source buffer and every destination buffer are ready for use */
+    ishmemi_team_sync_intra(info, team_ptr);
+    for (long c = 0; c < nchunks; c++) {
+        size_t offset = static_cast<size_t>(c) * chunk;
+        size_t len = (nelems - offset < chunk) ? (nelems - offset) : chunk;
+        if (!is_root) {
+            while (atomic_ready.load() < base + c + 1)
+                ;
+        }
+        if (!is_last) {
+            vec_copy_push(next_dest + offset, from + offset, len);
+            sycl::atomic_fence(sycl::memory_order::release, sycl::memory_scope::system);
+            atomic_next_ready.store(base + c + 1);
+        }
+        if (is_root && dest != src) vec_copy_push(dest + offset, src + offset, len);
+    }
+    return 0;
+}
+
+template <typename T, typename Group>
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_broadcast_pipelined_work_group(
+    ishmemi_info_t *info, ishmem_team_t team, T *dest, const T *src, size_t nelems, int PE_root,
+    const Group &grp)
+{
+    ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+    size_t chunk = ishmemi_broadcast_chunk_nelems<T>(info->bcast_pipeline_chunk);
+    long nchunks = static_cast<long>((nelems + chunk - 1) / chunk);
+    long base = team_ptr->bcast_chunks;
+
+    int next_idx = (team_ptr->my_pe + 1) % team_ptr->size;
+    bool is_root = (team_ptr->my_pe == PE_root);
+    bool is_last = (next_idx == PE_root);
+    const T *from = is_root ? src : dest;
+    uint8_t next_index = ISHMEMI_LOCAL_PES[ishmemi_team_pe(team_ptr, next_idx)];
+    T *next_dest = ISHMEMI_FAST_ADJUST(T, info, next_index, dest);
+    long *next_ready = ISHMEMI_FAST_ADJUST(long, info, next_index, &team_ptr->bcast_ready);
+
+    sycl::atomic_ref<long, sycl::memory_order::acq_rel, sycl::memory_scope::system,
+                     sycl::access::address_space::global_space>
+        atomic_ready(team_ptr->bcast_ready);
+    sycl::atomic_ref<long, sycl::memory_order::seq_cst, sycl::memory_scope::system,
+                     sycl::access::address_space::global_space>
+        atomic_next_ready(*next_ready);
+
+    /* assure that PE_root's source buffer and every destination buffer are ready for use; this
+     * also assures every work-item has read bcast_chunks before the leader updates it */
+    ishmemx_team_sync_work_group(team, grp);
+    if (grp.leader()) team_ptr->bcast_chunks = base + nchunks;
+    for (long c = 0; c < nchunks; c++) {
+        size_t offset = static_cast<size_t>(c) * chunk;
+        size_t len = (nelems - offset < chunk) ? (nelems - offset) : chunk;
+        if (!is_root) {
+            if (grp.leader()) {
+                while (atomic_ready.load() < base + c + 1)
+                    ;
+            }
+            sycl::group_barrier(grp); /* the chunk has arrived */
+        }
+        if (!is_last) {
+            vec_copy_work_group_push(next_dest + offset, from + offset, len, grp);
+            sycl::atomic_fence(sycl::memory_order::release, sycl::memory_scope::system);
+            sycl::group_barrier(grp); /* every work-item has forwarded its part of the chunk */
+            if (grp.leader()) atomic_next_ready.store(base + c + 1);
+        }
+        if (is_root && dest != src) vec_copy_work_group_push(dest + offset, src + offset, len, grp);
+    }
+    sycl::group_barrier(grp);
+    return 0;
+}
+
+#ifndef __SYCL_DEVICE_ONLY__
+/* Host version of the pipelined chain broadcast.  Chunks and signals are forwarded with IPC copies,
+ * and each PE polls its own host_bcast_ready through the host mapping of the heap */
+template <typename T>
+int ishmemi_broadcast_pipelined_host(ishmem_team_t team, T *dest, const T *src, size_t nelems,
+                                     int PE_root)
+{
+    int ret = 0;
+    ishmemi_team_host_t *team_ptr = &ishmemi_cpu_info->team_host_pool[team];
+    ishmemi_team_device_t *team_device = &ishmemi_mmap_gpu_info->team_device_pool[team];
+    size_t chunk = ishmemi_broadcast_chunk_nelems<T>(ishmemi_cpu_info->bcast_pipeline_chunk);
+    long nchunks = static_cast<long>((nelems + chunk - 1) / chunk);
+    long base = team_ptr->bcast_chunks;
+    team_ptr->bcast_chunks = base + nchunks;
+
+    int next_idx = (team_ptr->my_pe + 1) % team_ptr->size;
+    bool is_root = (team_ptr->my_pe == PE_root);
+    bool is_last = (next_idx == PE_root);
+    const T *from = is_root ? src : dest;
+    int next = ishmemi_team_pe(team_ptr, next_idx);
+    long *ready = &team_device->host_bcast_ready;
+    long *my_ready = (ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP)
+                         ? ready
+                         : ISHMEMI_DEVICE_TO_MMAP_ADDR(long, ready);
+
+    ishmemi_team_sync(team); /* assure PE_root's source and every destination are ready for use */
+    for (long c = 0; c < nchunks; c++) {
+        size_t offset = static_cast<size_t>(c) * chunk;
+        size_t len = (nelems - offset < chunk) ? (nelems - offset) : chunk;
+        if (!is_root) {
+            while (__atomic_load_n(my_ready, __ATOMIC_ACQUIRE) < base + c + 1)
+                ;
+        }
+        if (!is_last) {
+            long count = base + c + 1;
+            ret = ishmemi_ipc_put(dest + offset, from + offset, len, next);
+            ISHMEM_CHECK_RETURN_MSG(ret, "ishmemi_ipc_put within pipelined broadcast failed\n");
+            ret = ishmemi_ipc_put(ready, &count, 1, next);
+            ISHMEM_CHECK_RETURN_MSG(ret, "Pipelined broadcast failed to signal PE %d\n", next);
+        }
+        if (is_root && dest != src) {
+            ret = ishmemi_ipc_put(dest + offset, src + offset, len, ishmemi_my_pe);
+            ISHMEM_CHECK_RETURN_MSG(ret, "Pipelined broadcast failed to fill the root's dest\n");
+        }
+    }
+    return ret;
+}
+#endif
+
 /* Broadcast on a team: */
 template <typename T>
 int ishmem_broadcast(ishmem_team_t team, T *dest, const T *src, size_t nelems, int PE_root)
@@ -34,6 +235,10 @@ int ishmem_broadcast(ishmem_team_t team, T *dest, const T *src, size_t nelems, i
 
     if constexpr (ishmemi_is_device) {
         ishmemi_info_t *info = global_info;
+        if (team_ptr->only_intra &&
+            ishmemi_broadcast_use_pipeline(team_ptr->size, nbytes, info->bcast_pipeline_cutover)) {
+            return ishmemi_broadcast_pipelined(info, team_ptr, dest, src, nelems, PE_root);
+        }
         if (team_ptr->only_intra && !ISHMEM_BROADCAST_CUTOVER) {
 #if BROADCAST_PUSH
             if (team_ptr->my_pe == PE_root) {
@@ -66,6 +271,9 @@ int ishmem_broadcast(ishmem_team_t team, T *dest, const T *src, size_t nelems, i
             return ret;
 #endif
         }
+        if (ishmemi_team_is_hierarchical(info, team) && nelems != 0) {
+            return ishmemi_broadcast_hierarchical(dest, src, nelems, PE_root);
+        }
     }
 
     ishmemi_request_t req;
@@ -80,6 +288,11 @@ int ishmem_broadcast(ishmem_team_t team, T *dest, const T *src, size_t nelems, i
 #ifdef __SYCL_DEVICE_ONLY__
     ret = ishmemi_proxy_blocking_request_status(req);
 #else
+    if (team_ptr->only_intra && ISHMEMI_HOST_IN_HEAP(src) && ISHMEMI_HOST_IN_HEAP(dest) &&
+        ishmemi_broadcast_use_pipeline(team_ptr->size, nbytes,
+                                       ishmemi_cpu_info->bcast_pipeline_cutover)) {
+        return ishmemi_broadcast_pipelined_host(team, dest, src, nelems, PE_root);
+    }
 #if BROADCAST_PUSH
     if (team_ptr->only_intra && ISHMEMI_HOST_IN_HEAP(dest)) {
         if (team_ptr->my_pe == PE_root) {
@@ -175,6 +388,11 @@ int ishmemx_broadcast_work_group(ishmem_team_t team, T *dest, const T *src, size
             }
         }
 
+        if (team_ptr->only_intra &&
+            ishmemi_broadcast_use_pipeline(team_ptr->size, nbytes, info->bcast_pipeline_cutover)) {
+            return ishmemi_broadcast_pipelined_work_group(info, team, dest, src, nelems, PE_root,
+                                                          grp);
+        }
         if (team_ptr->only_intra && !ISHMEM_BROADCAST_GROUP_CUTOVER) {
 #if BROADCAST_PUSH
             /* make sure all threads have reached here, so source ready for use */
@@ -214,6 +432,11 @@ int ishmemx_broadcast_work_group(ishmem_team_t team, T *dest, const T *src, size
             return ret;
         } else {
             sycl::group_barrier(grp); /* assure source buffer ready for use */
+            if (ishmemi_team_is_hierarchical(info, team) && nelems != 0) {
+                if (grp.leader()) ret = ishmemi_broadcast_hierarchical(dest, src, nelems, PE_root);
+                ret = sycl::group_broadcast(grp, ret, 0);
+                return ret;
+            }
             if (grp.leader()) {
                 ishmemi_request_t req;
                 req.root = PE_root;
@@ -5,10 +5,12 @@
 #ifndef COLLECTIVES_COLLECT_IMPL_H
 #define COLLECTIVES_COLLECT_IMPL_H
 
+#include "ishmem/copy.h"
 #include "collectives.h"
 #include "sync_impl.h"
 #include "runtime.h"
 #include "runtime_ipc.h"
+#include "rma_impl.h"
 #include "on_queue.h"
 
 template <typename T>
@@ -350,6 +352,53 @@ int ishmem_fcollect(T *dest, const T *src, size_t nelems)
     return ret;
 }
 
+/* Hierarchical fcollect on ISHMEM_TEAM_WORLD: each node gathers its PEs' blocks into its leader's
+ * scratch buffer over IPC, the node leaders exchange the node blocks through the runtime, and
+ * each node pulls the result from its leader.  The node block must fit in the scratch buffer */
+template <typename T>
+ISHMEM_DEVICE_ATTRIBUTES inline bool ishmemi_fcollect_hierarchical_fits(size_t nelems)
+{
+    ishmemi_team_device_t *node_ptr = &global_info->team_device_pool[ISHMEMX_TEAM_NODE];
+    return (nelems != 0) &&
+           (nelems * sizeof(T) * static_cast<size_t>(node_ptr->size) <= ISHMEM_REDUCE_BUFFER_SIZE);
+}
+
+template <typename T>
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_fcollect_hierarchical(T *dest, const T *src, size_t nelems)
+{
+    int ret = 0;
+    ishmemi_info_t *info = global_info;
+    ishmemi_team_device_t *node_ptr = &info->team_device_pool[ISHMEMX_TEAM_NODE];
+    /* ISHMEM_TEAM_WORLD is not intra-node, so its scratch buffer is otherwise unused */
+    T *node_block = (T *) info->team_device_pool[ISHMEM_TEAM_WORLD].buffer;
+    uint8_t leader_index = ISHMEMI_LOCAL_PES[node_ptr->start];
+    size_t node_nelems = nelems * static_cast<size_t>(node_ptr->size);
+
+    T *leader_block = ISHMEMI_FAST_ADJUST(T, info, leader_index, node_block);
+    vec_copy_push(&leader_block[static_cast<size_t>(node_ptr->my_pe) * nelems], src, nelems);
+    ishmemi_team_sync_intra(info, node_ptr); /* assure the node block is complete */
+    if (node_ptr->my_pe == 0) {
+        ishmemi_request_t req;
+        req.src = node_block;
+        req.dst = dest;
+        req.nelems = node_nelems * sizeof(T);
+        req.op = FCOLLECT;
+        req.type = UINT8;
+        req.team = info->leader_team;
+#ifdef __SYCL_DEVICE_ONLY__
+        ret = ishmemi_proxy_blocking_request_status(req);
+#endif
+    }
+    /* assure the leader's destination buffer is complete */
+    ishmemi_team_sync_intra(info, node_ptr);
+    if (node_ptr->my_pe != 0) {
+        ishmem_internal_get(dest, dest, nelems * static_cast<size_t>(info->n_pes),
+                            node_ptr->start);
+    }
+    ishmemi_team_sync_intra(info, node_ptr); /* let the leader reuse its buffers */
+    return ret;
+}
+
 /* Fcollect on a team */
 template <typename T>
 int ishmem_fcollect(ishmem_team_t team, T *dest, const T *src, size_t nelems)
@@ -389,6 +438,10 @@ int ishmem_fcollect(ishmem_team_t team, T *dest, const T *src, size_t nelems)
             ishmemi_team_sync(team); /* assure all destination buffers complete */
             return ret;
         }
+        if (ishmemi_team_is_hierarchical(global_info, team) &&
+            ishmemi_fcollect_hierarchical_fits<T>(nelems)) {
+            return ishmemi_fcollect_hierarchical(dest, src, nelems);
+        }
     }
 
     /* Otherwise */
@@ -513,6 +566,10 @@ int ishmemx_fcollect_work_group(ishmem_team_t team, T *dest, const T *src, size_
              */
             ishmemx_team_sync_work_group(team, grp);
             return 0;
+        } else if (ishmemi_team_is_hierarchical(info, team) &&
+                   ishmemi_fcollect_hierarchical_fits<T>(nelems)) {
+            sycl::group_barrier(grp); /* assure source buffer ready for use */
+            if (grp.leader()) ret = ishmemi_fcollect_hierarchical(dest, src, nelems);
         } else {
             if (grp.leader()) {
                 ishmemi_request_t req;
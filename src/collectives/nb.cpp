@@ -0,0 +1,284 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "collectives/reduce_impl.h"
+#include "collectives.h"
+#include "runtime.h"
+
+/* A handle started on the device has this bit set, with the allocated completion index and the
+ * request sequence below it.  A handle started on the host is the runtime's request pointer */
+#define ISHMEMI_COLL_HANDLE_DEVICE (1ULL << 63)
+
+/* Collectives on intra-node teams are IPC copies between the team's syncs, which leave nothing to
+ * overlap, so they complete before returning.  So do host collectives the runtime has no
+ * nonblocking variant of */
+template <typename TEAM_PTR>
+static inline bool ishmemi_coll_nb_completes(TEAM_PTR team_ptr,
+                                             ishmemi_op_t op __attribute__((unused)),
+                                             ishmemi_type_t type __attribute__((unused)))
+{
+    if (team_ptr->only_intra) return true;
+#ifdef __SYCL_DEVICE_ONLY__
+    return false;
+#else
+    return (ishmemi_runtime->nb_funcs == nullptr) ||
+           (ishmemi_runtime->nb_funcs[op][type] == nullptr);
+#endif
+}
+
+/* Device requests go to the proxy with an allocated completion, so the work-item is free while
+ * the runtime runs the collective.  Host requests start the runtime's nonblocking collective */
+static int ishmemi_coll_nb_start(ishmemi_request_t &req, ishmemx_coll_handle_t *handle)
+{
+#ifdef __SYCL_DEVICE_ONLY__
+    *handle = ISHMEMI_COLL_HANDLE_DEVICE | ishmemi_proxy_allocated_request(req);
+    return 0;
+#else
+    void *request = nullptr;
+    int ret = ishmemi_runtime->nb_funcs[req.op][req.type](&req, &request);
+    *handle = (ret == 0) ? (ishmemx_coll_handle_t) request : ISHMEMX_COLL_HANDLE_NULL;
+    return ret;
+#endif
+}
+
+#if __SYCL_DEVICE_ONLY__
+#define ISHMEMI_COLL_NB_TEAM_PTR(team) (&global_info->team_device_pool[team])
+#else
+#define ISHMEMI_COLL_NB_TEAM_PTR(team) (&ishmemi_cpu_info->team_host_pool[team])
+#endif
+
+int ishmemx_alltoallmem_nb(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                           ishmemx_coll_handle_t *handle)
+{
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    if (ishmemi_coll_nb_completes(ISHMEMI_COLL_NB_TEAM_PTR(team), ALLTOALL, UINT8)) {
+        return ishmem_alltoallmem(team, dest, src, nelems);
+    }
+
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nelems;
+    req.op = ALLTOALL;
+    req.type = UINT8;
+    req.team = team;
+    return ishmemi_coll_nb_start(req, handle);
+}
+
+int ishmemx_broadcastmem_nb(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                            int PE_root, ishmemx_coll_handle_t *handle)
+{
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    if (ishmemi_coll_nb_completes(ISHMEMI_COLL_NB_TEAM_PTR(team), BCAST, UINT8)) {
+        return ishmem_broadcastmem(team, dest, src, nelems, PE_root);
+    }
+
+    ishmemi_request_t req;
+    req.root = PE_root;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nelems;
+    req.op = BCAST;
+    req.type = UINT8;
+    req.team = team;
+    return ishmemi_coll_nb_start(req, handle);
+}
+
+int ishmemx_collectmem_nb(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                          ishmemx_coll_handle_t *handle)
+{
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    if (ishmemi_coll_nb_completes(ISHMEMI_COLL_NB_TEAM_PTR(team), COLLECT, UINT8)) {
+        return ishmem_collectmem(team, dest, src, nelems);
+    }
+
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nelems;
+    req.op = COLLECT;
+    req.type = UINT8;
+    req.team = team;
+    return ishmemi_coll_nb_start(req, handle);
+}
+
+int ishmemx_fcollectmem_nb(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                           ishmemx_coll_handle_t *handle)
+{
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    if (ishmemi_coll_nb_completes(ISHMEMI_COLL_NB_TEAM_PTR(team), FCOLLECT, UINT8)) {
+        return ishmem_fcollectmem(team, dest, src, nelems);
+    }
+
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nelems;
+    req.op = FCOLLECT;
+    req.type = UINT8;
+    req.team = team;
+    return ishmemi_coll_nb_start(req, handle);
+}
+
+template <typename T, ishmemi_op_t OP>
+int ishmemi_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                      ishmemx_coll_handle_t *handle)
+{
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    bool completes = ishmemi_coll_nb_completes(ISHMEMI_COLL_NB_TEAM_PTR(team), OP,
+                                               ishmemi_union_get_base_type<T, OP>());
+#ifndef __SYCL_DEVICE_ONLY__
+    /* Host reductions on the heap stage through the team's bounce buffers, one chunk at a time */
+    completes = completes || ISHMEMI_HOST_IN_HEAP(dest) || ISHMEMI_HOST_IN_HEAP(src);
+#endif
+    if (completes) return ishmemi_reduce<T, OP>(team, dest, src, nreduce);
+
+    ishmemi_request_t req;
+    req.src = src;
+    req.dst = dest;
+    req.nelems = nreduce;
+    req.op = OP;
+    req.type = ishmemi_union_get_base_type<T, OP>();
+    req.team = team;
+    return ishmemi_coll_nb_start(req, handle);
+}
+
+template <typename T>
+int ishmemx_and_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                          ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, AND_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_or_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                         ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, OR_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_xor_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                          ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, XOR_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_max_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                          ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, MAX_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_min_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                          ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, MIN_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_sum_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                          ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, SUM_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+template <typename T>
+int ishmemx_prod_reduce_nb(ishmem_team_t team, T *dest, const T *src, size_t nreduce,
+                           ishmemx_coll_handle_t *handle)
+{
+    return ishmemi_reduce_nb<T, PROD_REDUCE>(team, dest, src, nreduce, handle);
+}
+
+int ishmemx_coll_test(ishmemx_coll_handle_t *handle, int *status)
+{
+    int ret = 0;
+    bool done = true;
+
+    if (*handle != ISHMEMX_COLL_HANDLE_NULL) {
+#ifdef __SYCL_DEVICE_ONLY__
+        ishmemi_info_t *info = global_info;
+        unsigned int index = static_cast<unsigned int>((*handle >> 16) & 0xffff);
+        uint16_t sequence = static_cast<uint16_t>(*handle & 0xffff);
+        done = info->completion.test(index, sequence);
+        if (done) {
+            ret = ishmemi_proxy_get_status(info->completions[index].completion.ret);
+            info->completion.free(index);
+        }
+#else
+        if (*handle & ISHMEMI_COLL_HANDLE_DEVICE) {
+            ISHMEM_ERROR_MSG("Nonblocking collective handle was started on the device\n");
+            return -1;
+        }
+        ret = ishmemi_runtime->request_test((void *) *handle, &done);
+#endif
+    }
+    if (!done) return 0;
+
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    if (status) *status = ret;
+    return 1;
+}
+
+int ishmemx_coll_wait(ishmemx_coll_handle_t *handle)
+{
+    int ret = 0;
+
+    if (*handle == ISHMEMX_COLL_HANDLE_NULL) return 0;
+#ifdef __SYCL_DEVICE_ONLY__
+    ishmemi_info_t *info = global_info;
+    unsigned int index = static_cast<unsigned int>((*handle >> 16) & 0xffff);
+    uint16_t sequence = static_cast<uint16_t>(*handle & 0xffff);
+    info->completion.wait(index, sequence);
+    ret = ishmemi_proxy_get_status(info->completions[index].completion.ret);
+    info->completion.free(index);
+#else
+    while (ishmemx_coll_test(handle, &ret) == 0) {
+    }
+#endif
+    *handle = ISHMEMX_COLL_HANDLE_NULL;
+    return ret;
+}
+
+/* clang-format off */
+#define ISHMEMI_INSTANTIATE_BITWISE_REDUCE_NB()                                                    \
+    ISHMEM_INSTANTIATE_TYPE_ulonglong(unsigned long long);                                         \
+    ISHMEM_INSTANTIATE_TYPE_int8(int8_t);                                                          \
+    ISHMEM_INSTANTIATE_TYPE_int16(int16_t);                                                        \
+    ISHMEM_INSTANTIATE_TYPE_int32(int32_t);                                                        \
+    ISHMEM_INSTANTIATE_TYPE_int64(int64_t);                                                        \
+    ISHMEM_INSTANTIATE_TYPE_uint8(uint8_t);                                                        \
+    ISHMEM_INSTANTIATE_TYPE_uint16(uint16_t);                                                      \
+    ISHMEM_INSTANTIATE_TYPE_uint32(uint32_t);                                                      \
+    ISHMEM_INSTANTIATE_TYPE_uint64(uint64_t);
+#define ISHMEMI_INSTANTIATE_ARITH_REDUCE_NB()                                                      \
+    ISHMEMI_INSTANTIATE_BITWISE_REDUCE_NB()                                                        \
+    ISHMEM_INSTANTIATE_TYPE_longlong(long long);                                                   \
+    ISHMEM_INSTANTIATE_TYPE_float(float);                                                          \
+    ISHMEM_INSTANTIATE_TYPE_double(double);
+
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_and_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_BITWISE_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_or_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_BITWISE_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_xor_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_BITWISE_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_max_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_ARITH_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_min_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_ARITH_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_sum_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_ARITH_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+#define ISHMEM_INSTANTIATE_TYPE(TYPE) template int ishmemx_prod_reduce_nb(ishmem_team_t, TYPE *, const TYPE *, size_t, ishmemx_coll_handle_t *)
+ISHMEMI_INSTANTIATE_ARITH_REDUCE_NB()
+#undef ISHMEM_INSTANTIATE_TYPE
+/* clang-format on */
@@ -0,0 +1,246 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "collectives/plan_impl.h"
+#include "collectives/alltoall_impl.h"
+#include "collectives/broadcast_impl.h"
+#include "accelerator.h"
+#include "teams.h"
+#include "on_queue.h"
+
+/* Adds a copy of nbytes from src to dest in the team PE peer, where dest and src are this PE's
+ * symmetric addresses.  Pull copies read src in the peer and write dest locally */
+static void ishmemi_plan_add_copy(ishmemi_plan_t *plan, ishmemi_team_host_t *team_ptr, int peer,
+                                  void *dest, const void *src, bool pull)
+{
+    int pe = ishmemi_team_pe(team_ptr, peer);
+    uint8_t local_index = ishmemi_local_pes[pe];
+    int idx = plan->ncopies++;
+
+    if (pull) {
+        plan->copy_dest[idx] = dest;
+        plan->copy_src[idx] = ISHMEMI_HOST_ADJUST_PTR(const void, local_index, src);
+    } else {
+        plan->copy_dest[idx] = ISHMEMI_HOST_ADJUST_PTR(void, local_index, dest);
+        plan->copy_src[idx] = src;
+    }
+    plan->put_items[idx].pe = pe;
+    plan->put_items[idx].dst = dest;
+    plan->put_items[idx].src = src;
+    plan->put_items[idx].size = plan->nbytes;
+}
+
+static int ishmemi_plan_create(ishmemi_op_t op, ishmem_team_t team, void *dest, const void *src,
+                               size_t nbytes, int root, ishmemx_plan_t *plan)
+{
+    if constexpr (enable_error_checking) validate_init();
+
+    int ret = 0;
+    ishmemi_plan_t *p = nullptr;
+    ishmemi_team_host_t *team_ptr = nullptr;
+    ishmemi_cpu_info_t *info __attribute__((unused)) = ishmemi_cpu_info; /* for the cutovers */
+    size_t total_nbytes __attribute__((unused)) = 0;
+    size_t base = 0;
+    bool in_heap = false;
+
+    ISHMEM_CHECK_GOTO_MSG(plan == nullptr, fn_fail, "Invalid plan argument\n");
+    *plan = nullptr;
+    ISHMEM_CHECK_GOTO_MSG(team <= ISHMEM_TEAM_INVALID || team >= (long) ishmemi_cpu_info->n_teams,
+                          fn_fail, "Invalid team %d for collective plan\n", team);
+    team_ptr = &ishmemi_cpu_info->team_host_pool[team];
+    ISHMEM_CHECK_GOTO_MSG(op == BCAST && (root < 0 || root >= team_ptr->size), fn_fail,
+                          "Invalid broadcast root %d for collective plan\n", root);
+
+    ret = ishmemi_usm_alloc_host((void **) &p, sizeof(ishmemi_plan_t));
+    ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "Unable to allocate collective plan\n");
+    memset(p, 0, sizeof(ishmemi_plan_t));
+    p->op = op;
+    p->team = team;
+    p->dest = dest;
+    p->src = src;
+    p->nbytes = nbytes;
+    p->root = root;
+
+    /* Collect is the only collective whose layout depends on the other PEs' arguments, so the
+     * sizes are exchanged here once rather than on every execution */
+    if (op == COLLECT) {
+        team_ptr->collect_mynelems = nbytes;
+        ishmemi_team_sync(team);
+        ret = ishmem_size_fcollect(team, team_ptr->collect_nelems, &team_ptr->collect_mynelems, 1);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "fcollect of the collect plan sizes failed\n");
+        for (int teampe = 0; teampe < team_ptr->size; teampe++) {
+            if (teampe < team_ptr->my_pe) base += team_ptr->collect_nelems[teampe];
+            total_nbytes += team_ptr->collect_nelems[teampe];
+        }
+    } else if (op == FCOLLECT || op == ALLTOALL) {
+        base = nbytes * static_cast<size_t>(team_ptr->my_pe);
+    }
+
+    in_heap = ISHMEMI_HOST_IN_HEAP(dest);
+    if (!team_ptr->only_intra || !in_heap) goto fn_exit;
+
+    switch (op) {
+        case ALLTOALL:
+            p->device_direct = !ISHMEM_ALLTOALL_CUTOVER;
+            p->group_direct = !ISHMEM_ALLTOALL_GROUP_CUTOVER;
+            p->host_direct = true;
+            for (int step = 0; step < team_ptr->size; step++) {
+                int peer = (info->alltoall_schedule == ISHMEMI_ALLTOALL_PAIRWISE)
+                               ? ishmemi_alltoall_peer(team_ptr->my_pe, step, team_ptr->size)
+                               : step;
+                ishmemi_plan_add_copy(p, team_ptr, peer, pointer_offset(dest, base),
+                                      pointer_offset(src, nbytes * static_cast<size_t>(peer)),
+                                      false);
+            }
+            break;
+        case BCAST:
+            /* Matches the broadcast implementation, which pulls from the root */
+            if (ishmemi_broadcast_use_pipeline(team_ptr->size, nbytes,
+                                               info->bcast_pipeline_cutover) ||
+                !ISHMEMI_HOST_IN_HEAP(src))
+                break;
+            p->device_direct = !ISHMEM_BROADCAST_CUTOVER;
+            p->group_direct = !ISHMEM_BROADCAST_GROUP_CUTOVER;
+            p->entry_sync = true;
+            ishmemi_plan_add_copy(p, team_ptr, root, dest, src, true);
+            break;
+        case COLLECT:
+            p->device_direct = !ISHMEM_COLLECT_CUTOVER;
+            p->group_direct = !ISHMEM_COLLECT_GROUP_CUTOVER;
+            p->host_direct = true;
+            for (int teampe = 0; teampe < team_ptr->size; teampe++) {
+                ishmemi_plan_add_copy(p, team_ptr, teampe, pointer_offset(dest, base), src, false);
+            }
+            break;
+        case FCOLLECT:
+            p->device_direct = !ISHMEM_FCOLLECT_CUTOVER;
+            p->group_direct = !ISHMEM_FCOLLECT_GROUP_CUTOVER;
+            p->host_direct = true;
+            for (int teampe = 0; teampe < team_ptr->size; teampe++) {
+                ishmemi_plan_add_copy(p, team_ptr, teampe, pointer_offset(dest, base), src, false);
+            }
+            break;
+        default:
+            break;
+    }
+
+fn_exit:
+    if (plan != nullptr && ret == 0) *plan = p;
+    return ret;
+fn_fail:
+    if (p != nullptr) ishmemi_usm_free(p);
+    p = nullptr;
+    if (ret == 0) ret = -1;
+    goto fn_exit;
+}
+
+int ishmemx_alltoallmem_plan_create(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                                    ishmemx_plan_t *plan)
+{
+    return ishmemi_plan_create(ALLTOALL, team, dest, src, nelems, 0, plan);
+}
+
+int ishmemx_broadcastmem_plan_create(ishmem_team_t team, void *dest, const void *src,
+                                     size_t nelems, int root, ishmemx_plan_t *plan)
+{
+    return ishmemi_plan_create(BCAST, team, dest, src, nelems, root, plan);
+}
+
+int ishmemx_collectmem_plan_create(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                                   ishmemx_plan_t *plan)
+{
+    return ishmemi_plan_create(COLLECT, team, dest, src, nelems, 0, plan);
+}
+
+int ishmemx_fcollectmem_plan_create(ishmem_team_t team, void *dest, const void *src, size_t nelems,
+                                    ishmemx_plan_t *plan)
+{
+    return ishmemi_plan_create(FCOLLECT, team, dest, src, nelems, 0, plan);
+}
+
+int ishmemx_plan_destroy(ishmemx_plan_t plan)
+{
+    if (plan == nullptr) return 0;
+    return ishmemi_usm_free(plan);
+}
+
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_plan_execute_collective(ishmemx_plan_t plan)
+{
+    switch (plan->op) {
+        case ALLTOALL:
+            return ishmem_alltoallmem(plan->team, plan->dest, plan->src, plan->nbytes);
+        case BCAST:
+            return ishmem_broadcastmem(plan->team, plan->dest, plan->src, plan->nbytes,
+                                       plan->root);
+        case COLLECT:
+            return ishmem_collectmem(plan->team, plan->dest, plan->src, plan->nbytes);
+        case FCOLLECT:
+            return ishmem_fcollectmem(plan->team, plan->dest, plan->src, plan->nbytes);
+        default:
+            return -1;
+    }
+}
+
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_plan_execute(ishmemx_plan_t plan)
+{
+#ifdef __SYCL_DEVICE_ONLY__
+    if (plan->device_direct) {
+        if (plan->entry_sync) ishmemi_team_sync(plan->team);
+        for (int i = 0; i < plan->ncopies; i++) {
+            vec_copy_push((uint8_t *) plan->copy_dest[i], (const uint8_t *) plan->copy_src[i],
+                          plan->nbytes);
+        }
+        ishmemi_team_sync(plan->team); /* assure destination buffers complete */
+        return 0;
+    }
+#else
+    if (plan->host_direct) {
+        int ret = ishmemi_ipc_put_v(plan->ncopies, plan->put_items);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "ishmemi_ipc_put_v within collective plan failed\n");
+    fn_fail:
+        ishmemi_team_sync(plan->team); /* assure destination buffers complete */
+        return ret;
+    }
+#endif
+    return ishmemi_plan_execute_collective(plan);
+}
+
+sycl::event ishmemx_plan_execute_on_queue(ishmemx_plan_t plan, int *ret, sycl::queue &q,
+                                          const std::vector<sycl::event> &deps)
+{
+    bool entry_already_exists = true;
+    const std::lock_guard<std::mutex> lock(ishmemi_on_queue_events_map.map_mtx);
+    auto iter = ishmemi_on_queue_events_map.get_entry_info(q, entry_already_exists);
+
+    size_t nbytes = plan->nbytes;
+    auto e = q.submit([&](sycl::handler &cgh) {
+        set_cmd_grp_dependencies(cgh, entry_already_exists, iter->second->event, deps);
+        if ((nbytes != 0) && plan->group_direct) {
+            size_t max_work_group_size = iter->second->max_work_group_size;
+            size_t range_size = (nbytes < max_work_group_size) ? nbytes : max_work_group_size;
+            cgh.parallel_for(
+                sycl::nd_range<1>(sycl::range<1>(range_size), sycl::range<1>(range_size)),
+                [=](sycl::nd_item<1> it) {
+                    int tmp_ret = ishmemx_plan_execute_work_group(plan, it.get_group());
+                    if (ret) *ret = tmp_ret;
+                });
+        } else {
+            cgh.single_task([=]() {
+                int tmp_ret = ishmemx_plan_execute(plan);
+                if (ret) *ret = tmp_ret;
+            });
+        }
+    });
+    ishmemi_on_queue_events_map[&q]->event = e;
+    return e;
+}
+
+/* clang-format off */
+template int ishmemx_plan_execute_work_group<sycl::group<1>>(ishmemx_plan_t plan, const sycl::group<1> &grp);
+template int ishmemx_plan_execute_work_group<sycl::group<2>>(ishmemx_plan_t plan, const sycl::group<2> &grp);
+template int ishmemx_plan_execute_work_group<sycl::group<3>>(ishmemx_plan_t plan, const sycl::group<3> &grp);
+template int ishmemx_plan_execute_work_group<sycl::sub_group>(ishmemx_plan_t plan, const sycl::sub_group &grp);
+/* clang-format on */
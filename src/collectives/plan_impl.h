@@ -0,0 +1,85 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef COLLECTIVES_PLAN_IMPL_H
+#define COLLECTIVES_PLAN_IMPL_H
+
+#include "ishmem/copy.h"
+#include "collectives.h"
+#include "sync_impl.h"
+#include "runtime.h"
+
+/* A collective plan holds the arguments of one collective call together with everything the
+ * intra-node device path would otherwise recompute on each call: the peer addresses, the peer
+ * order of the schedule, and for collect the offset derived from the other PEs' sizes.  Executing
+ * a direct plan is then a list of copies between two team syncs.  Plans live in host USM, so both
+ * the host and the device can read them */
+struct ishmemi_plan_t {
+    ishmemi_op_t op;
+    ishmem_team_t team;
+    void *dest;
+    const void *src;
+    size_t nbytes; /* nelems of the collective, in bytes */
+    int root;      /* broadcast root, in the team's numbering */
+    bool device_direct;
+    bool group_direct;
+    bool host_direct;
+    bool entry_sync; /* a direct execution reads peer memory, so it syncs the team first */
+    int ncopies;
+    void *copy_dest[MAX_LOCAL_PES];       /* device addresses, possibly in a peer's heap */
+    const void *copy_src[MAX_LOCAL_PES];  /* device addresses, possibly in a peer's heap */
+    struct put_item put_items[MAX_LOCAL_PES]; /* the same copies, for ishmemi_ipc_put_v */
+};
+
+/* Runs the collective the plan was created from, for plans without a direct path */
+ISHMEM_DEVICE_ATTRIBUTES int ishmemi_plan_execute_collective(ishmemx_plan_t plan);
+
+template <typename Group>
+int ishmemx_plan_execute_work_group(ishmemx_plan_t plan, const Group &grp)
+{
+    if constexpr (ishmemi_is_device) {
+        if (plan->group_direct) {
+            if (plan->entry_sync) {
+                ishmemx_team_sync_work_group(plan->team, grp);
+            } else {
+                sycl::group_barrier(grp); /* assure source buffer complete */
+            }
+            for (int i = 0; i < plan->ncopies; i++) {
+                vec_copy_work_group_push((uint8_t *) plan->copy_dest[i],
+                                         (const uint8_t *) plan->copy_src[i], plan->nbytes, grp);
+            }
+            ishmemx_team_sync_work_group(plan->team, grp); /* assure destination buffers complete */
+            return 0;
+        }
+
+        int ret = 0;
+        switch (plan->op) {
+            case ALLTOALL:
+                ret = ishmemx_alltoallmem_work_group(plan->team, plan->dest, plan->src,
+                                                     plan->nbytes, grp);
+                break;
+            case BCAST:
+                ret = ishmemx_broadcastmem_work_group(plan->team, plan->dest, plan->src,
+                                                      plan->nbytes, plan->root, grp);
+                break;
+            case COLLECT:
+                ret = ishmemx_collectmem_work_group(plan->team, plan->dest, plan->src,
+                                                    plan->nbytes, grp);
+                break;
+            case FCOLLECT:
+                ret = ishmemx_fcollectmem_work_group(plan->team, plan->dest, plan->src,
+                                                     plan->nbytes, grp);
+                break;
+            default:
+                ret = -1;
+                break;
+        }
+        return ret;
+    } else {
+        ISHMEM_ERROR_MSG("ISHMEMX_PLAN_EXECUTE_WORK_GROUP routines are not callable from host\n");
+        return -1;
+    }
+}
+
+#endif  // COLLECTIVES_PLAN_IMPL_H
@@ -9,6 +9,7 @@
 #include "ishmem/copy.h"
 #include "collectives.h"
 #include "sync_impl.h"
+#include <algorithm>
 #include <type_traits>
 #include "memory.h"
 #include "runtime.h"
@@ -182,27 +183,61 @@ inline void vector_reduce_work_group(T *d, const T *s, size_t count, const Group
     }
 }
 
-/* on a team... */
+/* on a team...
+ * The reduction runs through the team's host bounce buffers in chunks of
+ * ISHMEM_REDUCE_PIPELINE_CHUNK_SIZE bytes.  There are two buffers of each kind, so while the
+ * runtime reduces chunk k, the copy engine brings in chunk k + 1 and writes back chunk k - 1 */
 template <typename T, ishmemi_op_t OP>
 int ishmemi_generic_op_reduce(ishmem_team_t team, T *dest, const T *src, size_t nreduce)
 {
     int ret = 0;
-    size_t max_reduce = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+    size_t max_reduce = ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE / sizeof(T);
+    size_t nchunks = (nreduce + max_reduce - 1) / max_reduce;
     ishmemi_team_host_t *team_ptr = &ishmemi_cpu_info->team_host_pool[team];
 
-    while (nreduce > 0) {
-        size_t this_reduce = nreduce;
-        if (this_reduce > max_reduce) this_reduce = max_reduce;
-        void *cdst = ishmemi_copy((void *) team_ptr->source, (void *) src, this_reduce * sizeof(T));
-        if ((uintptr_t) cdst != (uintptr_t) team_ptr->source) {
-            ISHMEM_DEBUG_MSG("ishmemi_copy in failed\n");
-            return (1);
+    /* The copy slots and the bounce buffers of a team are shared by every thread of the process */
+    const std::lock_guard<std::mutex> lock(ishmemi_copy_async_mtx);
+
+    if (team_ptr->source == nullptr) {
+        ret = ishmemi_team_alloc_bounce_buffers(team_ptr);
+        if (ret != 0) return ret;
+    }
+
+    /* Copy slots 0 and 1 track the copies into source[0] and source[1], 2 and 3 the copies out of
+     * dest[0] and dest[1] */
+    T *source[2], *result[2];
+    for (int b = 0; b < 2; b++) {
+        size_t buffer_offset = static_cast<size_t>(b) * max_reduce * sizeof(T);
+        source[b] = pointer_offset((T *) team_ptr->source, buffer_offset);
+        result[b] = pointer_offset((T *) team_ptr->dest, buffer_offset);
+    }
+
+    if (nchunks > 0) {
+        ret = ishmemi_copy_async(source[0], src, std::min(nreduce, max_reduce) * sizeof(T), 0);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "ishmemi_copy_async in failed\n");
+    }
+
+    for (size_t k = 0; k < nchunks; k++) {
+        int b = static_cast<int>(k % 2);
+        size_t offset = k * max_reduce;
+        size_t this_reduce = std::min(nreduce - offset, max_reduce);
+
+        ret = ishmemi_copy_async_wait(b);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "ishmemi_copy_async in failed\n");
+        if (k + 1 < nchunks) {
+            size_t next_reduce = std::min(nreduce - offset - max_reduce, max_reduce);
+            ret = ishmemi_copy_async(source[1 - b], src + offset + max_reduce,
+                                     next_reduce * sizeof(T), 1 - b);
+            ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "ishmemi_copy_async in failed\n");
         }
+        /* result[b] is free once chunk k - 2 has been written back */
+        ret = ishmemi_copy_async_wait(2 + b);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "ishmemi_copy_async out failed\n");
 
         ishmemi_ringcompletion_t comp;
         ishmemi_request_t req;
-        req.src = team_ptr->source;
-        req.dst = team_ptr->dest;
+        req.src = source[b];
+        req.dst = result[b];
         req.nelems = this_reduce;
         req.op = OP;
         req.type = ishmemi_union_get_base_type<T, OP>();
@@ -210,21 +245,47 @@ int ishmemi_generic_op_reduce(ishmem_team_t team, T *dest, const T *src, size_t
 
         ishmemi_runtime->proxy_funcs[req.op][req.type](&req, &comp);
         ret = ishmemi_proxy_get_status(comp.completion.ret);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "runtime reduction failed\n");
 
-        if (ret != 0) {
-            ISHMEM_DEBUG_MSG("runtime reduction failed\n");
-            return ret;
-        }
-        cdst = ishmemi_copy((void *) dest, (void *) team_ptr->dest, this_reduce * sizeof(T));
-        if ((uintptr_t) cdst != (uintptr_t) dest) {
-            ISHMEM_DEBUG_MSG("ishmemi_copy out failed\n");
-            return 1;
-        }
-        dest += this_reduce;
-        src += this_reduce;
-        nreduce -= this_reduce;
+        ret = ishmemi_copy_async(dest + offset, result[b], this_reduce * sizeof(T), 2 + b);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "ishmemi_copy_async out failed\n");
     }
-    return (0);
+
+fn_exit:
+    /* Drain every copy still in flight, so the slots and buffers are free for the next call */
+    for (int slot = 0; slot < ISHMEMI_COPY_ASYNC_SLOTS; slot++) {
+        int wait_ret = ishmemi_copy_async_wait(slot);
+        if (ret == 0) ret = wait_ret;
+    }
+    return ret;
+}
+
+/* Reduce-scatter + allgather moves 2 (n - 1) / n of the array over the links per PE, where reading
+ * every peer's source moves (n - 1) times the array, at the cost of one more team sync.  Use it
+ * once the traffic saved by a PE reaches the cutover */
+template <typename T>
+inline bool ishmemi_reduce_use_rsag(ishmemi_info_t *info, int team_size, size_t nreduce)
+{
+    if (team_size < 3) return false;
+    size_t n = static_cast<size_t>(team_size);
+    size_t saved = ((n - 1) * (n - 2) * nreduce * sizeof(T)) / n;
+    return saved >= info->reduce_rsag_cutover;
+}
+
+/* Elements in the segment of each PE, rounded up to whole cache lines */
+template <typename T>
+inline size_t ishmemi_reduce_segment_size(size_t nreduce, int team_size)
+{
+    size_t align = (sizeof(T) < 64) ? (64 / sizeof(T)) : 1;
+    size_t seg = (nreduce + static_cast<size_t>(team_size) - 1) / static_cast<size_t>(team_size);
+    return ((seg + align - 1) / align) * align;
+}
+
+/* First element of the segment of team PE idx; the last segments may be short or empty */
+inline size_t ishmemi_reduce_segment_start(size_t nreduce, size_t seg, int idx)
+{
+    size_t lo = seg * static_cast<size_t>(idx);
+    return (lo < nreduce) ? lo : nreduce;
 }
 
 /* Sub-reduce - SYCL can't make recursive calls, so this function is used by the top-level reduce */
@@ -243,18 +304,99 @@ inline int ishmemi_sub_reduce(ishmem_team_t team, T *dest, const T *source, size
 
     ishmemi_team_sync(team); /* assure all source buffers are ready for use */
 
-    int idx = 0;
-    for (int pe = team_ptr->start; idx < team_ptr->size; pe += team_ptr->stride, idx++) {
-        if (pe == my_world_pe) continue;
-        uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
-        T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
+    /* In place, a PE only writes its own segment before the middle sync and only reads the owner's
+     * segment after it, so no source data is overwritten before its last use */
+    if (source == dest || ishmemi_reduce_use_rsag<T>(info, team_ptr->size, nreduce)) {
+        size_t seg = ishmemi_reduce_segment_size<T>(nreduce, team_ptr->size);
+        size_t my_lo = ishmemi_reduce_segment_start(nreduce, seg, team_ptr->my_pe);
+        size_t my_len = ishmemi_reduce_segment_start(nreduce, seg, team_ptr->my_pe + 1) - my_lo;
+
+        /* Reduce-scatter: reduce my segment of every source into my destination */
+        int idx = 0;
+        for (int pe = team_ptr->start; idx < team_ptr->size; pe += team_ptr->stride, idx++) {
+            if (pe == my_world_pe) continue;
+            uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+            T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
+
+            vector_reduce_helper(vector_reduce, dest + my_lo, remote + my_lo, my_len);
+        }
+        ishmemi_team_sync(team); /* assure every segment is reduced */
+
+        /* Allgather: copy every other segment from the destination of the PE that owns it */
+        idx = 0;
+        for (int pe = team_ptr->start; idx < team_ptr->size; pe += team_ptr->stride, idx++) {
+            if (pe == my_world_pe) continue;
+            uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+            T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, dest);
+            size_t lo = ishmemi_reduce_segment_start(nreduce, seg, idx);
+            size_t len = ishmemi_reduce_segment_start(nreduce, seg, idx + 1) - lo;
+
+            vec_copy_push(dest + lo, remote + lo, len);
+        }
+    } else {
+        int idx = 0;
+        for (int pe = team_ptr->start; idx < team_ptr->size; pe += team_ptr->stride, idx++) {
+            if (pe == my_world_pe) continue;
+            uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+            T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
 
-        vector_reduce_helper(vector_reduce, dest, remote, nreduce);
+            vector_reduce_helper(vector_reduce, dest, remote, nreduce);
+        }
     }
     ishmemi_team_sync(team);
     return ret;
 }
 
+/* Hierarchical reduction on ISHMEM_TEAM_WORLD: each node reduces into its leader's scratch buffer
+ * over IPC, the node leaders reduce across nodes through the runtime, and each node copies the
+ * result from its leader.  Staging through the scratch buffer also covers in-place reductions */
+template <typename T, ishmemi_op_t OP>
+inline int ishmemi_reduce_hierarchical(T *dest, const T *source, size_t nreduce)
+{
+    int ret = 0;
+    ishmemi_info_t *info = global_info;
+    ishmemi_team_device_t *node_ptr = &info->team_device_pool[ISHMEMX_TEAM_NODE];
+    /* ISHMEM_TEAM_WORLD is not intra-node, so its scratch buffer is otherwise unused */
+    T *buffer = (T *) info->team_device_pool[ISHMEM_TEAM_WORLD].buffer;
+    uint8_t leader_index = ISHMEMI_LOCAL_PES[node_ptr->start];
+    size_t max_nreduce = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+
+    while (nreduce > 0) {
+        size_t this_nreduce = (nreduce < max_nreduce) ? nreduce : max_nreduce;
+        vec_copy_push(buffer, source, this_nreduce);
+        ishmemi_team_sync_intra(info, node_ptr); /* assure all node buffers are ready for use */
+        if (node_ptr->my_pe == 0) {
+            for (int pe = node_ptr->start + 1; pe <= node_ptr->last_pe; pe += 1) {
+                uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+                T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, buffer);
+
+                vector_reduce_helper(vector_reduce, buffer, remote, this_nreduce);
+            }
+
+            ishmemi_request_t req;
+            req.src = buffer;
+            req.dst = dest;
+            req.nelems = this_nreduce;
+            req.op = OP;
+            req.type = ishmemi_union_get_base_type<T, OP>();
+            req.team = info->leader_team;
+#ifdef __SYCL_DEVICE_ONLY__
+            int res = ishmemi_proxy_blocking_request_status(req);
+            if (res != 0) ret = res;
+#endif
+        }
+        ishmemi_team_sync_intra(info, node_ptr); /* assure the leader's destination is complete */
+        if (node_ptr->my_pe != 0) {
+            vec_copy_push(dest, ISHMEMI_FAST_ADJUST(T, info, leader_index, dest), this_nreduce);
+        }
+        dest += this_nreduce;
+        source += this_nreduce;
+        nreduce -= this_nreduce;
+    }
+    ishmemi_team_sync_intra(info, node_ptr); /* let the leader reuse its destination buffer */
+    return ret;
+}
+
 /* on a team... */
 template <typename T, ishmemi_op_t OP>
 inline int ishmemi_reduce(ishmem_team_t team, T *dest, const T *source, size_t nreduce)
@@ -272,6 +414,10 @@ inline int ishmemi_reduce(ishmem_team_t team, T *dest, const T *source, size_t n
         /* if this operation involves multiple nodes, just call the proxy */
         if (team_ptr->only_intra) {
             size_t max_nreduce = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+            /* Reduce larger arrays in place between the peers' heaps, in one pass */
+            if (source == dest && nreduce > max_nreduce) {
+                return ishmemi_sub_reduce<T, OP>(team, dest, source, nreduce);
+            }
             if (source == dest) {
                 while (nreduce > 0) {
                     size_t this_nreduce = (nreduce < max_nreduce) ? nreduce : max_nreduce;
@@ -288,6 +434,9 @@ inline int ishmemi_reduce(ishmem_team_t team, T *dest, const T *source, size_t n
             vec_copy_push(dest, source, nreduce);
             return ishmemi_sub_reduce<T, OP>(team, dest, source, nreduce);
         }
+        if (ishmemi_team_is_hierarchical(global_info, team) && nreduce != 0) {
+            return ishmemi_reduce_hierarchical<T, OP>(dest, source, nreduce);
+        }
     }
 
 #ifndef __SYCL_DEVICE_ONLY__
@@ -349,12 +498,46 @@ inline int ishmemi_sub_reduce_work_group(ishmem_team_t team, T *dest, const T *s
             ishmemx_team_sync_work_group(team, grp);
             int idx = 0;
             int my_world_pe = ishmem_team_translate_pe(team, team_ptr->my_pe, ISHMEM_TEAM_WORLD);
-            for (int pe = team_ptr->start; idx < team_ptr->size; pe += team_ptr->stride, idx++) {
-                if (pe == my_world_pe) continue;
-                uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
-                T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
-
-                vector_reduce_helper(vector_reduce_work_group, dest, remote, nreduce, grp);
+            /* In place is safe with reduce-scatter + allgather, see ishmemi_sub_reduce */
+            if (source == dest || ishmemi_reduce_use_rsag<T>(info, team_ptr->size, nreduce)) {
+                size_t seg = ishmemi_reduce_segment_size<T>(nreduce, team_ptr->size);
+                size_t my_lo = ishmemi_reduce_segment_start(nreduce, seg, team_ptr->my_pe);
+                size_t my_len =
+                    ishmemi_reduce_segment_start(nreduce, seg, team_ptr->my_pe + 1) - my_lo;
+
+                /* Reduce-scatter: reduce my segment of every source into my destination */
+                for (int pe = team_ptr->start; idx < team_ptr->size;
+                     pe += team_ptr->stride, idx++) {
+                    if (pe == my_world_pe) continue;
+                    uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+                    T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
+
+                    vector_reduce_helper(vector_reduce_work_group, dest + my_lo, remote + my_lo,
+                                         my_len, grp);
+                }
+                ishmemx_team_sync_work_group(team, grp); /* assure every segment is reduced */
+
+                /* Allgather: copy every other segment from the destination of its owner */
+                idx = 0;
+                for (int pe = team_ptr->start; idx < team_ptr->size;
+                     pe += team_ptr->stride, idx++) {
+                    if (pe == my_world_pe) continue;
+                    uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+                    T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, dest);
+                    size_t lo = ishmemi_reduce_segment_start(nreduce, seg, idx);
+                    size_t len = ishmemi_reduce_segment_start(nreduce, seg, idx + 1) - lo;
+
+                    vec_copy_work_group_push(dest + lo, remote + lo, len, grp);
+                }
+            } else {
+                for (int pe = team_ptr->start; idx < team_ptr->size;
+                     pe += team_ptr->stride, idx++) {
+                    if (pe == my_world_pe) continue;
+                    uint8_t local_index = ISHMEMI_LOCAL_PES[pe];
+                    T *remote = ISHMEMI_FAST_ADJUST(T, info, local_index, source);
+
+                    vector_reduce_helper(vector_reduce_work_group, dest, remote, nreduce, grp);
+                }
             }
             /* assure all threads have finished copies (group_barrier)
              * assure destination buffers complete and source buffers may be reused */
@@ -393,7 +576,18 @@ inline int ishmemi_reduce_work_group(ishmem_team_t team, T *dest, const T *sourc
             if (grp.leader())
                 validate_parameters((void *) dest, (void *) source, nreduce * sizeof(T));
         }
+        if (ishmemi_team_is_hierarchical(info, team) && nreduce != 0) {
+            int ret = 0;
+            sycl::group_barrier(grp); /* assure local source buffer ready for use */
+            if (grp.leader()) ret = ishmemi_reduce_hierarchical<T, OP>(dest, source, nreduce);
+            ret = sycl::group_broadcast(grp, ret, 0);
+            return ret;
+        }
         size_t max_nreduce = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+        /* Reduce larger intra-node arrays in place between the peers' heaps, in one pass */
+        if (source == dest && nreduce > max_nreduce && info->team_device_pool[team].only_intra) {
+            return ishmemi_sub_reduce_work_group<T, OP>(team, dest, source, nreduce, grp);
+        }
         if (source == dest) {
             while (nreduce > 0) {
                 size_t this_nreduce = (nreduce < max_nreduce) ? nreduce : max_nreduce;
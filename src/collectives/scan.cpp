@@ -72,3 +72,69 @@ ISHMEMI_API_IMPL_EXSCAN(uint32, uint32_t)
 ISHMEMI_API_IMPL_EXSCAN(uint64, uint64_t)
 ISHMEMI_API_IMPL_EXSCAN(size, size_t)
 ISHMEMI_API_IMPL_EXSCAN(ptrdiff, ptrdiff_t)
+
+/* clang-format off */
+#define ISHMEMI_API_IMPL_SCAN_WORK_GROUP(SCAN, TYPENAME, TYPE)                                                                                                                           \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<1>>(TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<1> &grp);                                      \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<2>>(TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<2> &grp);                                      \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<3>>(TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<3> &grp);                                      \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::sub_group>(TYPE *dest, const TYPE *src, size_t nelems, const sycl::sub_group &grp);                                    \
+    template <typename Group> int ishmemx_##TYPENAME##_sum_##SCAN##_work_group(TYPE *dest, const TYPE *src, size_t nelems, const Group &grp) {                                             \
+        return ishmemx_sum_##SCAN##_work_group(dest, src, nelems, grp);                                                                                                                 \
+    }                                                                                                                                                                                   \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<1>>(ishmem_team_t team, TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<1> &grp);                  \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<2>>(ishmem_team_t team, TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<2> &grp);                  \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::group<3>>(ishmem_team_t team, TYPE *dest, const TYPE *src, size_t nelems, const sycl::group<3> &grp);                  \
+    template int ishmemx_##TYPENAME##_sum_##SCAN##_work_group<sycl::sub_group>(ishmem_team_t team, TYPE *dest, const TYPE *src, size_t nelems, const sycl::sub_group &grp);                \
+    template <typename Group> int ishmemx_##TYPENAME##_sum_##SCAN##_work_group(ishmem_team_t team, TYPE *dest, const TYPE *src, size_t nelems, const Group &grp) {                         \
+        return ishmemx_sum_##SCAN##_work_group(team, dest, src, nelems, grp);                                                                                                           \
+    }
+/* clang-format on */
+
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, float, float)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, double, double)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, char, char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, schar, signed char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, short, short)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, int, int)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, long, long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, longlong, long long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uchar, unsigned char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, ushort, unsigned short)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uint, unsigned int)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, ulong, unsigned long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, int8, int8_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, int16, int16_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, int32, int32_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, int64, int64_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uint8, uint8_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uint16, uint16_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uint32, uint32_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, uint64, uint64_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, size, size_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(inscan, ptrdiff, ptrdiff_t)
+
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, float, float)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, double, double)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, char, char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, schar, signed char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, short, short)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, int, int)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, long, long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, longlong, long long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uchar, unsigned char)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, ushort, unsigned short)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uint, unsigned int)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, ulong, unsigned long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, ulonglong, unsigned long long)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, int8, int8_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, int16, int16_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, int32, int32_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, int64, int64_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uint8, uint8_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uint16, uint16_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uint32, uint32_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, uint64, uint64_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, size, size_t)
+ISHMEMI_API_IMPL_SCAN_WORK_GROUP(exscan, ptrdiff, ptrdiff_t)
@@ -9,6 +9,116 @@
 #include "runtime.h"
 #include "proxy_impl.h"
 #include "on_queue.h"
+#include "collectives/reduce_impl.h"
+
+/* Adds nelems elements of remote into dest */
+template <typename T>
+inline void ishmemi_scan_add(T *dest, T *remote, size_t nelems)
+{
+    constexpr ishmemi_op_t OP = SUM_REDUCE;
+    vector_reduce_helper(vector_reduce, dest, remote, nelems);
+}
+
+template <typename T, typename Group>
+inline void ishmemi_scan_add_work_group(T *dest, T *remote, size_t nelems, const Group &grp)
+{
+    constexpr ishmemi_op_t OP = SUM_REDUCE;
+    vector_reduce_helper(vector_reduce_work_group, dest, remote, nelems, grp);
+}
+
+/* Intra-node scan: each PE sums the sources of the PEs before it in the team, read over IPC.  A
+ * node holds few PEs, so reading every predecessor directly costs less than the team sync per round
+ * of a logarithmic scan, and it needs no scratch space when source and dest differ */
+template <typename T, ishmemi_op_t OP>
+inline void ishmemi_sub_scan(ishmem_team_t team, T *dest, const T *source, size_t nelems)
+{
+    ishmemi_info_t *info = global_info;
+    ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+
+    ishmemi_team_sync(team); /* assure all source buffers are ready for use */
+    if constexpr (OP == INSCAN) {
+        vec_copy_push(dest, source, nelems);
+    } else if (team_ptr->my_pe == 0) {
+        for (size_t i = 0; i < nelems; i++)
+            dest[i] = 0;
+    }
+    int pe = team_ptr->start;
+    for (int idx = 0; idx < team_ptr->my_pe; idx++, pe += team_ptr->stride) {
+        T *remote = ISHMEMI_FAST_ADJUST(T, info, ISHMEMI_LOCAL_PES[pe], source);
+        if (OP == EXSCAN && idx == 0) vec_copy_push(dest, remote, nelems);
+        else ishmemi_scan_add(dest, remote, nelems);
+    }
+    ishmemi_team_sync(team); /* assure no PE still reads a source buffer */
+}
+
+template <typename T, ishmemi_op_t OP, typename Group>
+inline void ishmemi_sub_scan_work_group(ishmem_team_t team, T *dest, const T *source, size_t nelems,
+                                        const Group &grp)
+{
+    ishmemi_info_t *info = global_info;
+    ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+
+    ishmemx_team_sync_work_group(team, grp); /* assure all source buffers are ready for use */
+    if constexpr (OP == INSCAN) {
+        vec_copy_work_group_push(dest, source, nelems, grp);
+    } else if (team_ptr->my_pe == 0) {
+        for (size_t i = grp.get_local_linear_id(); i < nelems; i += grp.get_local_linear_range())
+            dest[i] = 0;
+    }
+    int pe = team_ptr->start;
+    for (int idx = 0; idx < team_ptr->my_pe; idx++, pe += team_ptr->stride) {
+        T *remote = ISHMEMI_FAST_ADJUST(T, info, ISHMEMI_LOCAL_PES[pe], source);
+        /* the copies and the adds split dest among the work-items differently */
+        sycl::group_barrier(grp);
+        if (OP == EXSCAN && idx == 0) vec_copy_work_group_push(dest, remote, nelems, grp);
+        else ishmemi_scan_add_work_group(dest, remote, nelems, grp);
+    }
+    ishmemx_team_sync_work_group(team, grp); /* assure no PE still reads a source buffer */
+}
+
+/* In place, successors would read a dest that is already overwritten, so the source is staged
+ * through the team's reduction buffer */
+template <typename T, ishmemi_op_t OP>
+inline int ishmemi_scan_intra(ishmem_team_t team, T *dest, const T *source, size_t nelems)
+{
+    if (source != dest) {
+        ishmemi_sub_scan<T, OP>(team, dest, source, nelems);
+        return 0;
+    }
+    T *buffer = (T *) global_info->team_device_pool[team].buffer;
+    size_t max_nelems = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+    while (nelems > 0) {
+        size_t this_nelems = (nelems < max_nelems) ? nelems : max_nelems;
+        vec_copy_push(buffer, source, this_nelems);
+        ishmemi_sub_scan<T, OP>(team, dest, buffer, this_nelems);
+        dest += this_nelems;
+        source += this_nelems;
+        nelems -= this_nelems;
+    }
+    return 0;
+}
+
+template <typename T, ishmemi_op_t OP, typename Group>
+inline int ishmemi_scan_intra_work_group(ishmem_team_t team, T *dest, const T *source,
+                                         size_t nelems, const Group &grp)
+{
+    if (source != dest) {
+        ishmemi_sub_scan_work_group<T, OP>(team, dest, source, nelems, grp);
+        return 0;
+    }
+    T *buffer = (T *) global_info->team_device_pool[team].buffer;
+    size_t max_nelems = ISHMEM_REDUCE_BUFFER_SIZE / sizeof(T);
+    while (nelems > 0) {
+        size_t this_nelems = (nelems < max_nelems) ? nelems : max_nelems;
+        sycl::group_barrier(grp); /* assure source buffer complete on all threads */
+        vec_copy_work_group_push(buffer, source, this_nelems, grp);
+        ishmemi_sub_scan_work_group<T, OP>(team, dest, buffer, this_nelems, grp);
+        dest += this_nelems;
+        source += this_nelems;
+        nelems -= this_nelems;
+    }
+    return 0;
+}
 
 template <typename T, ishmemi_op_t OP>
 int scan_impl(ishmem_team_t team, T *dest, const T *src, size_t nelems)
@@ -17,6 +127,12 @@ int scan_impl(ishmem_team_t team, T *dest, const T *src, size_t nelems)
         validate_parameters((void *) dest, (void *) src, nelems * sizeof(T));
     }
 
+    if constexpr (ishmemi_is_device) {
+        if (global_info->team_device_pool[team].only_intra) {
+            return ishmemi_scan_intra<T, OP>(team, dest, src, nelems);
+        }
+    }
+
     ishmemi_request_t req;
     req.src = src;
     req.dst = dest;
@@ -46,6 +162,65 @@ int ishmem_sum_exscan(ishmem_team_t team, T *dest, const T *src, size_t nelems)
     return scan_impl<T, EXSCAN>(team, dest, src, nelems);
 }
 
+template <typename T, ishmemi_op_t OP, typename Group>
+int scan_work_group_impl(ishmem_team_t team, T *dest, const T *src, size_t nelems,
+                         const Group &grp)
+{
+    if constexpr (ishmemi_is_device) {
+        if constexpr (enable_error_checking) {
+            if (grp.leader()) validate_parameters((void *) dest, (void *) src, nelems * sizeof(T));
+        }
+        if (global_info->team_device_pool[team].only_intra) {
+            return ishmemi_scan_intra_work_group<T, OP>(team, dest, src, nelems, grp);
+        }
+
+        int ret = 0;
+        sycl::group_barrier(grp); /* assure source buffer complete on all threads */
+        if (grp.leader()) {
+            ishmemi_request_t req;
+            req.src = src;
+            req.dst = dest;
+            req.nelems = nelems;
+            req.op = OP;
+            req.type = ishmemi_union_get_base_type<T, OP>();
+            req.team = team;
+
+            ret = ishmemi_proxy_blocking_request_status(req);
+        }
+        ret = sycl::group_broadcast(grp, ret, 0);
+        return ret;
+    } else {
+        ISHMEM_ERROR_MSG("ISHMEMX_SCAN_WORK_GROUP routines are not callable from host\n");
+        return -1;
+    }
+}
+
+template <typename T, typename Group>
+int ishmemx_sum_inscan_work_group(ishmem_team_t team, T *dest, const T *src, size_t nelems,
+                                  const Group &grp)
+{
+    return scan_work_group_impl<T, INSCAN>(team, dest, src, nelems, grp);
+}
+
+template <typename T, typename Group>
+int ishmemx_sum_inscan_work_group(T *dest, const T *src, size_t nelems, const Group &grp)
+{
+    return scan_work_group_impl<T, INSCAN>(ISHMEM_TEAM_WORLD, dest, src, nelems, grp);
+}
+
+template <typename T, typename Group>
+int ishmemx_sum_exscan_work_group(ishmem_team_t team, T *dest, const T *src, size_t nelems,
+                                  const Group &grp)
+{
+    return scan_work_group_impl<T, EXSCAN>(team, dest, src, nelems, grp);
+}
+
+template <typename T, typename Group>
+int ishmemx_sum_exscan_work_group(T *dest, const T *src, size_t nelems, const Group &grp)
+{
+    return scan_work_group_impl<T, EXSCAN>(ISHMEM_TEAM_WORLD, dest, src, nelems, grp);
+}
+
 template <typename T, ishmemi_op_t OP>
 sycl::event scan_on_queue_impl(ishmem_team_t team, T *dest, const T *src, size_t nelems, int *ret,
                                sycl::queue &q, const std::vector<sycl::event> &deps)
@@ -54,12 +229,25 @@ sycl::event scan_on_queue_impl(ishmem_team_t team, T *dest, const T *src, size_t
     const std::lock_guard<std::mutex> lock(ishmemi_on_queue_events_map.map_mtx);
     auto iter = ishmemi_on_queue_events_map.get_entry_info(q, entry_already_exists);
 
+    ishmemi_team_host_t *myteam = &ishmemi_cpu_info->team_host_pool[team];
     auto e = q.submit([&](sycl::handler &cgh) {
         set_cmd_grp_dependencies(cgh, entry_already_exists, iter->second->event, deps);
-        cgh.single_task([=]() {
-            int tmp_ret = scan_impl<T, OP>(team, dest, src, nelems);
-            if (ret) *ret = tmp_ret;
-        });
+        if ((nelems != 0) && (myteam->only_intra)) {
+            size_t max_work_group_size = iter->second->max_work_group_size;
+            size_t range_size = (nelems < max_work_group_size) ? nelems : max_work_group_size;
+            cgh.parallel_for(
+                sycl::nd_range<1>(sycl::range<1>(range_size), sycl::range<1>(range_size)),
+                [=](sycl::nd_item<1> it) {
+                    int tmp_ret =
+                        scan_work_group_impl<T, OP>(team, dest, src, nelems, it.get_group());
+                    if (ret) *ret = tmp_ret;
+                });
+        } else {
+            cgh.single_task([=]() {
+                int tmp_ret = scan_impl<T, OP>(team, dest, src, nelems);
+                if (ret) *ret = tmp_ret;
+            });
+        }
     });
     ishmemi_on_queue_events_map[&q]->event = e;
     return e;
@@ -12,6 +12,31 @@
 #include "teams.h"
 #include "on_queue.h"
 
+void ishmemi_team_sync_dissemination_host(ishmem_team_t team)
+{
+    ishmemi_team_host_t *team_ptr = &ishmemi_cpu_info->team_host_pool[team];
+    ishmemi_team_device_t *team_device = &ishmemi_mmap_gpu_info->team_device_pool[team];
+
+    long epoch = ++team_ptr->sync_epoch;
+    int round = 0;
+    for (int dist = 1; dist < team_ptr->size; dist <<= 1, round++) {
+        int peer = ishmemi_team_pe(team_ptr, (team_ptr->my_pe + dist) % team_ptr->size);
+        long *flag = &team_device->host_sync_flags[round];
+
+        /* The flags live in the device symmetric heap, so signal the peer with an IPC copy and
+         * poll our own flag through the host mapping of the heap */
+        int ret = ishmemi_ipc_put(flag, &epoch, 1, peer);
+        if (ret) RAISE_ERROR_MSG("Dissemination sync failed to signal PE %d\n", peer);
+
+        long *my_flag = (ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP)
+                            ? flag
+                            : ISHMEMI_DEVICE_TO_MMAP_ADDR(long, flag);
+        /* A peer already in the next sync may have stored epoch + 1 */
+        while (__atomic_load_n(my_flag, __ATOMIC_ACQUIRE) < epoch)
+            ;
+    }
+}
+
 void ishmem_sync_all()
 {
     ishmemi_team_sync(ISHMEM_TEAM_WORLD);
@@ -27,42 +27,120 @@ static inline void sync_team_fallback(ishmem_team_t team)
 #endif
 }
 
-ISHMEM_DEVICE_ATTRIBUTES inline void ishmemi_team_sync(ishmem_team_t team)
+/* Host dissemination sync for intra-node teams, defined in sync.cpp */
+void ishmemi_team_sync_dissemination_host(ishmem_team_t team);
+
+/* Dissemination sync: in round k, each pe signals the team member 2^k positions ahead of it and
+ * waits for the signal from the member 2^k positions behind it.  After ceil(log2(size)) rounds
+ * every pe has transitively heard from every other pe.  Each round costs one remote store and one
+ * local poll, instead of the size remote atomics of the linear sync */
+ISHMEM_DEVICE_ATTRIBUTES inline void
+ishmemi_team_sync_dissemination(ishmemi_info_t *info, ishmemi_team_device_t *team_ptr)
 {
-    /* Node-local, on-device implementation */
-    if constexpr (ishmemi_is_device) {
-        ishmemi_info_t *info = global_info;
-        ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
-        if (team_ptr->only_intra) {
-            sycl::atomic_fence(sycl::memory_order::seq_cst, sycl::memory_scope::system);
+    sycl::atomic_fence(sycl::memory_order::seq_cst, sycl::memory_scope::system);
 
-            int index = team_ptr->psync_idx;
-            long *my_psync = &team_ptr->psync[team_ptr->psync_idx];
-            team_ptr->psync_idx = (index + 1) % N_PSYNCS_PER_TEAM;
+    long epoch = ++team_ptr->sync_epoch;
+    int round = 0;
+    for (int dist = 1; dist < team_ptr->size; dist <<= 1, round++) {
+        int peer = ishmemi_team_pe(team_ptr, (team_ptr->my_pe + dist) % team_ptr->size);
+        long *remote_flag =
+            ISHMEMI_FAST_ADJUST(long, info, ISHMEMI_LOCAL_PES[peer], &team_ptr->sync_flags[round]);
 
-            /* This atomic has to be seq_cst because we definitely want it to happen in order */
-            sycl::atomic_ref<long, sycl::memory_order::seq_cst, sycl::memory_scope::system,
-                             sycl::access::address_space::global_space>
-                atomic_psync(*my_psync);
+        sycl::atomic_ref<long, sycl::memory_order::seq_cst, sycl::memory_scope::system,
+                         sycl::access::address_space::global_space>
+            atomic_remote_flag(*remote_flag);
+        atomic_remote_flag.store(epoch);
 
-            for (int i = team_ptr->start; i <= team_ptr->last_pe; i += team_ptr->stride) {
-                uint8_t local_index = ISHMEMI_LOCAL_PES[i];
-                long *remote_psync = ISHMEMI_FAST_ADJUST(long, info, local_index, my_psync);
+        sycl::atomic_ref<long, sycl::memory_order::acq_rel, sycl::memory_scope::system,
+                         sycl::access::address_space::global_space>
+            atomic_flag(team_ptr->sync_flags[round]);
+        /* A peer already in the next sync may have stored epoch + 1 */
+        while (atomic_flag.load() < epoch)
+            ;
+    }
+}
 
-                /* These atomics can be relaxed because we don't care about their ordering */
-                sycl::atomic_ref<long, sycl::memory_order::relaxed, sycl::memory_scope::system,
-                                 sycl::access::address_space::global_space>
-                    atomic_psync(*remote_psync);
-                atomic_psync += 1L;
-            }
+/* Sync of a team whose members are all reachable over IPC */
+ISHMEM_DEVICE_ATTRIBUTES inline void ishmemi_team_sync_intra(ishmemi_info_t *info,
+                                                             ishmemi_team_device_t *team_ptr)
+{
+    if (info->team_sync_algorithm == ISHMEMI_TEAM_SYNC_DISSEMINATION) {
+        ishmemi_team_sync_dissemination(info, team_ptr);
+        return;
+    }
+
+    sycl::atomic_fence(sycl::memory_order::seq_cst, sycl::memory_scope::system);
+
+    int index = team_ptr->psync_idx;
+    long *my_psync = &team_ptr->psync[team_ptr->psync_idx];
+    team_ptr->psync_idx = (index + 1) % N_PSYNCS_PER_TEAM;
 
-            while (atomic_psync.load() != team_ptr->size)
-                ;
-            atomic_psync.store(0);
+    /* This atomic has to be seq_cst because we definitely want it to happen in order */
+    sycl::atomic_ref<long, sycl::memory_order::seq_cst, sycl::memory_scope::system,
+                     sycl::access::address_space::global_space>
+        atomic_psync(*my_psync);
 
+    for (int i = team_ptr->start; i <= team_ptr->last_pe; i += team_ptr->stride) {
+        uint8_t local_index = ISHMEMI_LOCAL_PES[i];
+        long *remote_psync = ISHMEMI_FAST_ADJUST(long, info, local_index, my_psync);
+
+        /* These atomics can be relaxed because we don't care about their ordering */
+        sycl::atomic_ref<long, sycl::memory_order::relaxed, sycl::memory_scope::system,
+                         sycl::access::address_space::global_space>
+            atomic_psync(*remote_psync);
+        atomic_psync += 1L;
+    }
+
+    while (atomic_psync.load() != team_ptr->size)
+        ;
+    atomic_psync.store(0);
+}
+
+/* Hierarchical collectives apply to ISHMEM_TEAM_WORLD on multi-node jobs where every node holds
+ * the same number of consecutive PEs (see ishmemi_team_init).  The node's PEs cooperate over IPC
+ * through ISHMEMX_TEAM_NODE, and only the node leader (the first PE of the node) goes through the
+ * runtime, using leader_team, which holds one leader per node */
+ISHMEM_DEVICE_ATTRIBUTES inline bool ishmemi_team_is_hierarchical(ishmemi_info_t *info,
+                                                                  ishmem_team_t team)
+{
+    return info->hierarchical && (team == ISHMEM_TEAM_WORLD);
+}
+
+/* Hierarchical sync: the node syncs over IPC, the leaders sync through the runtime, and a second
+ * node sync releases the rest of the node */
+ISHMEM_DEVICE_ATTRIBUTES inline void ishmemi_team_sync_hierarchical(ishmemi_info_t *info)
+{
+    ishmemi_team_device_t *node_ptr = &info->team_device_pool[ISHMEMX_TEAM_NODE];
+
+    ishmemi_team_sync_intra(info, node_ptr);
+    if (node_ptr->my_pe == 0) sync_team_fallback(info->leader_team);
+    ishmemi_team_sync_intra(info, node_ptr);
+}
+
+ISHMEM_DEVICE_ATTRIBUTES inline void ishmemi_team_sync(ishmem_team_t team)
+{
+    /* Node-local, on-device implementation */
+    if constexpr (ishmemi_is_device) {
+        ishmemi_info_t *info = global_info;
+        ishmemi_team_device_t *team_ptr = &info->team_device_pool[team];
+        if (team_ptr->only_intra) {
+            ishmemi_team_sync_intra(info, team_ptr);
             return;
         }
+        if (ishmemi_team_is_hierarchical(info, team)) {
+            ishmemi_team_sync_hierarchical(info);
+            return;
+        }
+    }
+
+#ifndef __SYCL_DEVICE_ONLY__
+    /* Node-local, on-host implementation */
+    if (ishmemi_cpu_info->team_sync_algorithm == ISHMEMI_TEAM_SYNC_DISSEMINATION &&
+        ishmemi_cpu_info->team_host_pool[team].only_intra) {
+        ishmemi_team_sync_dissemination_host(team);
+        return;
     }
+#endif
 
     /* Otherwise */
     sync_team_fallback(team);
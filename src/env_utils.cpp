@@ -162,6 +162,52 @@ fn_fail:
     goto fn_exit;
 }
 
+/* Reads a tuning file written by scripts/ishmem_cutover_tune.  Each line holds the name of a
+ * cutover variable without the ISHMEM_ prefix and its value, e.g. "RMA_CUTOVER 16K", and '#' starts
+ * a comment */
+static int parse_cutover_file(const std::string &path)
+{
+    int ret = 0;
+    char line[256];
+    int lineno = 0;
+    FILE *fp = fopen(path.c_str(), "r");
+
+    ISHMEM_CHECK_GOTO_MSG(fp == nullptr, fn_fail, "Could not open cutover file '%s'\n",
+                          path.c_str());
+
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        char name[128], value[64];
+        size_t cutover;
+
+        lineno++;
+        char *comment = strchr(line, '#');
+        if (comment != nullptr) *comment = '\0';
+        if (sscanf(line, "%127s %63s", name, value) != 2) continue;
+
+        auto iter = ishmemi_env.find(name);
+        size_t len = strlen(name);
+        if (iter == ishmemi_env.end() || len < 8 || strcmp(name + len - 8, "_CUTOVER") != 0 ||
+            !std::holds_alternative<size_t>(iter->second.first)) {
+            ISHMEM_WARN_MSG("Ignoring unknown cutover '%s' at %s:%d\n", name, path.c_str(), lineno);
+            continue;
+        }
+        if (iter->second.second) continue; /* already set in the environment */
+
+        ret = atol_scaled(value, &cutover);
+        ISHMEM_CHECK_GOTO_MSG(ret != 0, fn_fail,
+                              "Could not parse '%s' as a value for %s at %s:%d\n", value, name,
+                              path.c_str(), lineno);
+        iter->second = std::make_pair(cutover, false);
+    }
+
+fn_exit:
+    if (fp != nullptr) fclose(fp);
+    return ret;
+fn_fail:
+    ret = 1;
+    goto fn_exit;
+}
+
 int ishmemi_parse_env(void)
 {
     int ret = 0;
@@ -204,6 +250,12 @@ int ishmemi_parse_env(void)
         }
     }
 
+    /* Cutovers set in the environment take precedence over the tuning file */
+    if (!std::get<std::string>(ishmemi_env["CUTOVER_FILE"].first).empty()) {
+        ret = parse_cutover_file(std::get<std::string>(ishmemi_env["CUTOVER_FILE"].first));
+        ISHMEM_CHECK_GOTO_MSG(ret != 0, fn_exit, "Failed to read ISHMEM_CUTOVER_FILE\n");
+    }
+
     /* Fill ishmemi_params with the default/user values */
 #define ISHMEMI_ENV_DEF(NAME, KIND, DEFAULT, SHORT_DESC)                                           \
     ishmemi_params.NAME = std::get<KIND>(ishmemi_env[#NAME].first);
@@ -15,6 +15,7 @@
 #include "collectives/collect_impl.h"
 #include "collectives/alltoall_impl.h"
 #include <cstdlib>  // abort
+#include <cstring>  // strcasecmp
 
 int ishmemi_my_pe;
 int ishmemi_n_pes;
@@ -133,6 +134,8 @@ void ishmemi_init_op_str()
     ishmemi_op_str[BARRIER] = "barrier_all";
     ishmemi_op_str[SYNC] = "sync_all";
     ishmemi_op_str[ALLTOALL] = "alltoall";
+    ishmemi_op_str[ALLTOALLS] = "alltoalls";
+    ishmemi_op_str[ALLTOALLV] = "alltoallv";
     ishmemi_op_str[BCAST] = "broadcast";
     ishmemi_op_str[COLLECT] = "collect";
     ishmemi_op_str[FCOLLECT] = "fcollect";
@@ -221,6 +224,38 @@ void ishmemx_query_initialized(int *initialized)
 #endif  // end !__SYCL_DEVICE_ONLY__
 }
 
+/* Copies the cutovers into both info structures.  ISHMEM_CUTOVER_MODE=always or never sends all
+ * device operations through the proxy or none of them, for comparing the two paths */
+static void ishmemi_cutover_init()
+{
+    ishmemi_cutover_t cutover;
+    const char *mode = ishmemi_params.CUTOVER_MODE.c_str();
+
+    if (strcasecmp(mode, "always") == 0 || strcasecmp(mode, "never") == 0) {
+        size_t value = (strcasecmp(mode, "always") == 0) ? 0 : SIZE_MAX;
+        cutover = {value, value, value, value, value, value,
+                   value, value, value, value, value, value};
+    } else {
+        if (strcasecmp(mode, "production") != 0) {
+            ISHMEM_WARN_MSG("Unknown ISHMEM_CUTOVER_MODE '%s', using 'production'\n", mode);
+        }
+        cutover.rma = ishmemi_params.RMA_CUTOVER;
+        cutover.rma_group = ishmemi_params.RMA_GROUP_CUTOVER;
+        cutover.strided_rma = ishmemi_params.STRIDED_RMA_CUTOVER;
+        cutover.strided_rma_group = ishmemi_params.STRIDED_RMA_GROUP_CUTOVER;
+        cutover.alltoall = ishmemi_params.ALLTOALL_CUTOVER;
+        cutover.alltoall_group = ishmemi_params.ALLTOALL_GROUP_CUTOVER;
+        cutover.broadcast = ishmemi_params.BROADCAST_CUTOVER;
+        cutover.broadcast_group = ishmemi_params.BROADCAST_GROUP_CUTOVER;
+        cutover.fcollect = ishmemi_params.FCOLLECT_CUTOVER;
+        cutover.fcollect_group = ishmemi_params.FCOLLECT_GROUP_CUTOVER;
+        cutover.collect = ishmemi_params.COLLECT_CUTOVER;
+        cutover.collect_group = ishmemi_params.COLLECT_GROUP_CUTOVER;
+    }
+    ishmemi_cpu_info->cutover = cutover;
+    ishmemi_mmap_gpu_info->cutover = cutover;
+}
+
 static void ishmemi_init(ishmemx_attr_t *attr, bool user_attr)
 {
     int ret = -1;
@@ -311,6 +346,7 @@ static void ishmemi_init(ishmemx_attr_t *attr, bool user_attr)
     ishmemi_mmap_gpu_info->n_pes = ishmemi_n_pes;
     ishmemi_mmap_gpu_info->heap_base = ishmemi_heap_base;
     ishmemi_mmap_gpu_info->heap_length = ishmemi_heap_length;
+    ishmemi_cutover_init();
 
     /* Setup local_pes info for host use */
     ishmemi_local_pes = (uint8_t *) ::malloc(static_cast<size_t>(ishmemi_n_pes));
@@ -429,6 +465,8 @@ void ishmem_finalize()
 
     ishmem_barrier_all();
 
+    if (ishmemi_params.HEAP_REPORT && ishmemi_cpu_info->attr->gpu) ishmemi_memory_report();
+
     ret = ishmemi_proxy_fini();
     ISHMEM_CHECK_GOTO_MSG(ret, fail, "Proxy finalize failed '%d'\n", ret);
 
@@ -758,6 +758,60 @@ ISHMEM_DEVICE_ATTRIBUTES int ishmem_size_alltoall(ishmem_team_t, size_t *, const
 ISHMEM_DEVICE_ATTRIBUTES int ishmem_ptrdiff_alltoall(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, size_t);
 ISHMEM_DEVICE_ATTRIBUTES int ishmem_alltoallmem(ishmem_team_t, void *, const void *, size_t);
 
+/* alltoalls */
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmem_alltoalls(T *, const T *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_float_alltoalls(float *, const float *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_double_alltoalls(double *, const double *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_char_alltoalls(char *, const char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_schar_alltoalls(signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_short_alltoalls(short *, const short *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int_alltoalls(int *, const int *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_long_alltoalls(long *, const long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_longlong_alltoalls(long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uchar_alltoalls(unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ushort_alltoalls(unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint_alltoalls(unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ulong_alltoalls(unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ulonglong_alltoalls(unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int8_alltoalls(int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int16_alltoalls(int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int32_alltoalls(int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int64_alltoalls(int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint8_alltoalls(uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint16_alltoalls(uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint32_alltoalls(uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint64_alltoalls(uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_size_alltoalls(size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ptrdiff_alltoalls(ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_alltoallsmem(void *, const void *, ptrdiff_t, ptrdiff_t, size_t);
+
+/* alltoalls on a team */
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmem_alltoalls(ishmem_team_t, T *, const T *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_float_alltoalls(ishmem_team_t, float *, const float *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_double_alltoalls(ishmem_team_t, double *, const double *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_char_alltoalls(ishmem_team_t, char *, const char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_schar_alltoalls(ishmem_team_t, signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_short_alltoalls(ishmem_team_t, short *, const short *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int_alltoalls(ishmem_team_t, int *, const int *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_long_alltoalls(ishmem_team_t, long *, const long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_longlong_alltoalls(ishmem_team_t, long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uchar_alltoalls(ishmem_team_t, unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ushort_alltoalls(ishmem_team_t, unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint_alltoalls(ishmem_team_t, unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ulong_alltoalls(ishmem_team_t, unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ulonglong_alltoalls(ishmem_team_t, unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int8_alltoalls(ishmem_team_t, int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int16_alltoalls(ishmem_team_t, int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int32_alltoalls(ishmem_team_t, int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_int64_alltoalls(ishmem_team_t, int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint8_alltoalls(ishmem_team_t, uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint16_alltoalls(ishmem_team_t, uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint32_alltoalls(ishmem_team_t, uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_uint64_alltoalls(ishmem_team_t, uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_size_alltoalls(ishmem_team_t, size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_ptrdiff_alltoalls(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t);
+ISHMEM_DEVICE_ATTRIBUTES int ishmem_alltoallsmem(ishmem_team_t, void *, const void *, ptrdiff_t, ptrdiff_t, size_t);
+
 /* broadcast */
 template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmem_broadcast(T *, const T *, size_t, int);
 ISHMEM_DEVICE_ATTRIBUTES int ishmem_float_broadcast(float *, const float *, size_t, int);
@@ -13,62 +13,50 @@
 #include <cstdlib>
 
 /* Tuning Parameters
- * To tune for a system, run bandwidth tests with CUTOVER_NEVER and again with CUTOVER_ALWAYS. Use
- * the results to choose proper CUTOVER_PRODUCTION values
- *
- * TODO: Allow for runtime-configurable cutovers
+ * Each cutover is the size in bytes at or above which an intra-node device operation is handed to
+ * the copy engines rather than done with device loads and stores.  The values come from the
+ * ISHMEM_*_CUTOVER environment variables or from the tuning file named by ISHMEM_CUTOVER_FILE, and
+ * ISHMEM_CUTOVER_MODE=always or never overrides all of them, which is how the
+ * scripts/ishmem_cutover_tune sweep measures both paths.  Broadcast compares nbytes times the
+ * number of PEs and collect compares the total bytes divided by the number of PEs
  */
-#define CUTOVER_PRODUCTION 1
-#define CUTOVER_ALWAYS     0
-#define CUTOVER_NEVER      0
-
-#if CUTOVER_NEVER
-
-#define ISHMEM_RMA_CUTOVER               (false)
-#define ISHMEM_RMA_GROUP_CUTOVER         (false)
-#define ISHMEM_STRIDED_RMA_CUTOVER       (false)
-#define ISHMEM_STRIDED_RMA_GROUP_CUTOVER (false)
-#define ISHMEM_ALLTOALL_CUTOVER          (false)
-#define ISHMEM_ALLTOALL_GROUP_CUTOVER    (false)
-#define ISHMEM_BROADCAST_CUTOVER         (false)
-#define ISHMEM_BROADCAST_GROUP_CUTOVER   (false)
-#define ISHMEM_COLLECT_CUTOVER           (false)
-#define ISHMEM_COLLECT_GROUP_CUTOVER     (false)
-#define ISHMEM_FCOLLECT_CUTOVER          (false)
-#define ISHMEM_FCOLLECT_GROUP_CUTOVER    (false)
-
-#elif CUTOVER_ALWAYS
-
-#define ISHMEM_RMA_CUTOVER               (true)
-#define ISHMEM_RMA_GROUP_CUTOVER         (true)
-#define ISHMEM_STRIDED_RMA_CUTOVER       (true)
-#define ISHMEM_STRIDED_RMA_GROUP_CUTOVER (true)
-#define ISHMEM_ALLTOALL_CUTOVER          (true)
-#define ISHMEM_ALLTOALL_GROUP_CUTOVER    (true)
-#define ISHMEM_BROADCAST_CUTOVER         (true)
-#define ISHMEM_BROADCAST_GROUP_CUTOVER   (true)
-#define ISHMEM_COLLECT_CUTOVER           (true)
-#define ISHMEM_COLLECT_GROUP_CUTOVER     (true)
-#define ISHMEM_FCOLLECT_CUTOVER          (true)
-#define ISHMEM_FCOLLECT_GROUP_CUTOVER    (true)
-
-#else /* CUTOVER_PRODUCTION */
-
-#define ISHMEM_RMA_CUTOVER               (nbytes >= 16384L)
-#define ISHMEM_RMA_GROUP_CUTOVER         (nbytes >= 32768L)
-#define ISHMEM_STRIDED_RMA_CUTOVER       (nbytes >= 16384L)
-#define ISHMEM_STRIDED_RMA_GROUP_CUTOVER (nbytes >= 32768L)
-#define ISHMEM_ALLTOALL_CUTOVER          (nbytes >= 128L)
-#define ISHMEM_ALLTOALL_GROUP_CUTOVER    (nbytes >= 16384L)
-#define ISHMEM_BROADCAST_CUTOVER         ((nbytes * ((size_t) info->n_pes)) >= 8192L)
+typedef struct ishmemi_cutover_t {
+    size_t rma;
+    size_t rma_group;
+    size_t strided_rma;
+    size_t strided_rma_group;
+    size_t alltoall;
+    size_t alltoall_group;
+    size_t broadcast;
+    size_t broadcast_group;
+    size_t fcollect;
+    size_t fcollect_group;
+    size_t collect;
+    size_t collect_group;
+} ishmemi_cutover_t;
+
+#ifdef __SYCL_DEVICE_ONLY__
+#define ISHMEMI_CUTOVER global_info->cutover
+#else
+#define ISHMEMI_CUTOVER ishmemi_cpu_info->cutover
+#endif
+
+#define ISHMEM_RMA_CUTOVER               (nbytes >= ISHMEMI_CUTOVER.rma)
+#define ISHMEM_RMA_GROUP_CUTOVER         (nbytes >= ISHMEMI_CUTOVER.rma_group)
+#define ISHMEM_STRIDED_RMA_CUTOVER       (nbytes >= ISHMEMI_CUTOVER.strided_rma)
+#define ISHMEM_STRIDED_RMA_GROUP_CUTOVER (nbytes >= ISHMEMI_CUTOVER.strided_rma_group)
+#define ISHMEM_ALLTOALL_CUTOVER          (nbytes >= ISHMEMI_CUTOVER.alltoall)
+#define ISHMEM_ALLTOALL_GROUP_CUTOVER    (nbytes >= ISHMEMI_CUTOVER.alltoall_group)
+#define ISHMEM_BROADCAST_CUTOVER                                                                   \
+    ((nbytes * ((size_t) info->n_pes)) >= ISHMEMI_CUTOVER.broadcast)
 // preferred BROADCAST_GROUP_CUTOVER is nbytes * threads > 512
-#define ISHMEM_BROADCAST_GROUP_CUTOVER   (nbytes >= 65536L)
-#define ISHMEM_FCOLLECT_CUTOVER          (nbytes >= 1024L)
-#define ISHMEM_FCOLLECT_GROUP_CUTOVER    (nbytes >= 32768L)
-#define ISHMEM_COLLECT_CUTOVER           (total_nbytes >= (1024L * ((size_t) info->n_pes)))
-#define ISHMEM_COLLECT_GROUP_CUTOVER     (total_nbytes >= (32768L * ((size_t) info->n_pes)))
-
-#endif /* CUTOVER */
+#define ISHMEM_BROADCAST_GROUP_CUTOVER   (nbytes >= ISHMEMI_CUTOVER.broadcast_group)
+#define ISHMEM_FCOLLECT_CUTOVER          (nbytes >= ISHMEMI_CUTOVER.fcollect)
+#define ISHMEM_FCOLLECT_GROUP_CUTOVER    (nbytes >= ISHMEMI_CUTOVER.fcollect_group)
+#define ISHMEM_COLLECT_CUTOVER                                                                     \
+    ((total_nbytes / ((size_t) info->n_pes)) >= ISHMEMI_CUTOVER.collect)
+#define ISHMEM_COLLECT_GROUP_CUTOVER                                                               \
+    ((total_nbytes / ((size_t) info->n_pes)) >= ISHMEMI_CUTOVER.collect_group)
 
 /* Copy utility function */
 void *ishmem_copy(void *dst, const void *src, size_t size);
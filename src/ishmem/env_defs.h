@@ -21,19 +21,81 @@ ISHMEMI_ENV_DEF(ENABLE_GPU_IPC_PIDFD, bool, true,
 ISHMEMI_ENV_DEF(SYMMETRIC_SIZE, size_t, 512 * 1024 * 1024, "Symmetric heap size")
 ISHMEMI_ENV_DEF(ENABLE_ACCESSIBLE_HOST_HEAP, bool, false,
                 "Enable shared symmetric heap in host and device")
+ISHMEMI_ENV_DEF(HEAP_REPORT, bool, false, "Print symmetric heap usage report at finalize")
 
 /* Tuning parameters */
-ISHMEMI_ENV_DEF(NBI_COUNT, size_t, 1024, "NBI operations between GC")
-ISHMEMI_ENV_DEF(MWAIT_BURST, size_t, 0, "Use UMONITOR UMWAIT in proxy thread, burst count")
+ISHMEMI_ENV_DEF(NBI_COUNT, size_t, 1024,
+                "NBI operations between GC, and outstanding MPI RMA requests")
+ISHMEMI_ENV_DEF(MWAIT_BURST, size_t, 0,
+                "Use UMONITOR UMWAIT in proxy thread and host waits, burst count")
+ISHMEMI_ENV_DEF(REDUCE_PIPELINE_CHUNK_SIZE, size_t, 1024 * 1024,
+                "Bytes per chunk of pipelined host reductions")
+ISHMEMI_ENV_DEF(REDUCE_RSAG_CUTOVER, size_t, 64 * 1024,
+                "Link bytes saved per PE above which intra-node reductions use reduce-scatter")
+ISHMEMI_ENV_DEF(ALLTOALL_SCHEDULE, std::string, "pairwise",
+                "Intra-node device alltoall schedule: pairwise or linear")
+ISHMEMI_ENV_DEF(BROADCAST_PIPELINE_CUTOVER, size_t, 256 * 1024,
+                "Bytes above which intra-node broadcasts are pipelined along a chain of PEs")
+ISHMEMI_ENV_DEF(BROADCAST_PIPELINE_CHUNK_SIZE, size_t, 64 * 1024,
+                "Bytes per chunk of pipelined intra-node broadcasts")
+ISHMEMI_ENV_DEF(CUTOVER_MODE, std::string, "production",
+                "Device copy engine cutovers: production, always, or never")
+ISHMEMI_ENV_DEF(CUTOVER_FILE, std::string, "", "Tuning file of device copy engine cutovers")
+ISHMEMI_ENV_DEF(RMA_CUTOVER, size_t, 16384, "Bytes at or above which device RMA uses the proxy")
+ISHMEMI_ENV_DEF(RMA_GROUP_CUTOVER, size_t, 32768,
+                "Bytes at or above which work-group RMA uses the proxy")
+ISHMEMI_ENV_DEF(STRIDED_RMA_CUTOVER, size_t, 16384,
+                "Bytes at or above which device strided RMA uses the proxy")
+ISHMEMI_ENV_DEF(STRIDED_RMA_GROUP_CUTOVER, size_t, 32768,
+                "Bytes at or above which work-group strided RMA uses the proxy")
+ISHMEMI_ENV_DEF(ALLTOALL_CUTOVER, size_t, 128,
+                "Bytes per PE at or above which device alltoall uses the proxy")
+ISHMEMI_ENV_DEF(ALLTOALL_GROUP_CUTOVER, size_t, 16384,
+                "Bytes per PE at or above which work-group alltoall uses the proxy")
+ISHMEMI_ENV_DEF(BROADCAST_CUTOVER, size_t, 8192,
+                "Bytes times PEs at or above which device broadcast uses the proxy")
+ISHMEMI_ENV_DEF(BROADCAST_GROUP_CUTOVER, size_t, 65536,
+                "Bytes at or above which work-group broadcast uses the proxy")
+ISHMEMI_ENV_DEF(FCOLLECT_CUTOVER, size_t, 1024,
+                "Bytes per PE at or above which device fcollect uses the proxy")
+ISHMEMI_ENV_DEF(FCOLLECT_GROUP_CUTOVER, size_t, 32768,
+                "Bytes per PE at or above which work-group fcollect uses the proxy")
+ISHMEMI_ENV_DEF(COLLECT_CUTOVER, size_t, 1024,
+                "Average bytes per PE at or above which device collect uses the proxy")
+ISHMEMI_ENV_DEF(COLLECT_GROUP_CUTOVER, size_t, 32768,
+                "Average bytes per PE at or above which work-group collect uses the proxy")
+ISHMEMI_ENV_DEF(PROGRESS_INTERVAL, size_t, 50,
+                "Microseconds between MPI progress calls while no MPI operations are outstanding")
+ISHMEMI_ENV_DEF(PROGRESS_THREAD, bool, false, "Make MPI progress on a dedicated helper thread")
+ISHMEMI_ENV_DEF(PROGRESS_REPORT, bool, false,
+                "Print MPI progress and datatype cache statistics at finalize")
+ISHMEMI_ENV_DEF(MPI_SHARED_SLOT_SIZE, size_t, 4096,
+                "Bytes per PE of the MPI intra-node shared window, 0 disables")
+ISHMEMI_ENV_DEF(ENABLE_MPI_DATATYPES, bool, false,
+                "Use MPI derived datatypes for strided RMA on GPU memory")
+ISHMEMI_ENV_DEF(MPI_DATATYPE_CACHE_SIZE, size_t, 256,
+                "Maximum number of cached MPI strided datatypes, 0 for no limit")
+ISHMEMI_ENV_DEF(ENABLE_OPENSHMEM_CONTEXT, bool, true,
+                "Issue proxied OpenSHMEM RMA on a private context")
+ISHMEMI_ENV_DEF(PMI_SHARED_SLOT_SIZE, size_t, 65536,
+                "Bytes per PE of the PMI runtime's shared-memory staging slot")
 
 /* Library name definitions */
 ISHMEMI_ENV_DEF(SHMEM_LIB_NAME, std::string, "libsma.so", "SHMEM Library name")
 ISHMEMI_ENV_DEF(MPI_LIB_NAME, std::string, "libmpi.so", "MPI Library name")
 ISHMEMI_ENV_DEF(PMI_LIB_NAME, std::string, "libpmi.so", "PMI Library name")
 
-ISHMEMI_ENV_DEF(TEAMS_MAX, size_t, 64, "Maximum number of teams per PE")
+ISHMEMI_ENV_DEF(TEAMS_MAX, size_t, 512, "Maximum number of teams per PE")
+ISHMEMI_ENV_DEF(TEAMS_PREALLOC, size_t, 64,
+                "Teams allocated at initialization, which splits of any parent team can use")
 ISHMEMI_ENV_DEF(TEAM_SHARED_ONLY_SELF, bool, false,
                 "Include only the self PE in ISHMEM_TEAM_SHARED")
+ISHMEMI_ENV_DEF(TEAM_SYNC_ALGORITHM, std::string, "linear",
+                "Intra-node team sync algorithm: linear or dissemination")
+ISHMEMI_ENV_DEF(TEAM_LAZY_CREATE, bool, true,
+                "Split intra-node teams without the runtime, creating runtime teams on first use")
+ISHMEMI_ENV_DEF(ENABLE_HIERARCHICAL_COLLECTIVES, bool, false,
+                "Run ISHMEM_TEAM_WORLD device collectives per node, then across node leaders")
 
 /* Runtime definitions */
 ISHMEMI_ENV_DEF(RUNTIME, std::string, ISHMEM_DEFAULT_RUNTIME_STR,
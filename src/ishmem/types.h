@@ -60,6 +60,8 @@ typedef enum : uint16_t {
     BARRIER,
     SYNC,
     ALLTOALL,
+    ALLTOALLS,
+    ALLTOALLV,
     BCAST,
     COLLECT,
     FCOLLECT,
@@ -142,6 +144,8 @@ constexpr ishmemi_op_t ISHMEMI_OP_signal_set = SIGNAL_SET;
 constexpr ishmemi_op_t ISHMEMI_OP_barrier_all = BARRIER;
 constexpr ishmemi_op_t ISHMEMI_OP_sync_all = SYNC;
 constexpr ishmemi_op_t ISHMEMI_OP_alltoall = ALLTOALL;
+constexpr ishmemi_op_t ISHMEMI_OP_alltoalls = ALLTOALLS;
+constexpr ishmemi_op_t ISHMEMI_OP_alltoallv = ALLTOALLV;
 constexpr ishmemi_op_t ISHMEMI_OP_broadcast = BCAST;
 constexpr ishmemi_op_t ISHMEMI_OP_collect = COLLECT;
 constexpr ishmemi_op_t ISHMEMI_OP_fcollect = FCOLLECT;
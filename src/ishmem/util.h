@@ -484,6 +484,8 @@ ISHMEM_DEVICE_ATTRIBUTES constexpr bool ishmemi_op_uses_team()
     if constexpr (ishmemi_op_is_reduction<OP>()) return true;
     else if constexpr (ishmemi_op_is_scan<OP>()) return true;
     else if constexpr (OP == ALLTOALL) return true;
+    else if constexpr (OP == ALLTOALLS) return true;
+    else if constexpr (OP == ALLTOALLV) return true;
     else if constexpr (OP == BCAST) return true;
     else if constexpr (OP == COLLECT) return true;
     else if constexpr (OP == FCOLLECT) return true;
@@ -32,12 +32,31 @@ typedef struct ishmemx_attr_t {
     };
 } ishmemx_attr_t;
 
+/* Number of power-of-two size classes in the heap allocation histogram */
+#define ISHMEMX_HEAP_HIST_BUCKETS 32
+
+/* Snapshot of symmetric heap usage on the calling PE */
+typedef struct ishmemx_heap_info_t {
+    size_t heap_size;           /* bytes managed by the symmetric heap allocator */
+    size_t bytes_in_use;        /* bytes currently allocated, including allocator rounding */
+    size_t peak_bytes_in_use;   /* high-water mark of bytes_in_use */
+    size_t bytes_free;          /* bytes available for allocation */
+    size_t largest_free_block;  /* largest contiguous free region */
+    size_t num_free_segments;   /* number of disjoint free regions */
+    size_t num_allocations;     /* number of live allocations */
+    /* histogram[i] counts allocation requests of [2^i, 2^(i+1)) bytes; the last bucket is open */
+    size_t histogram[ISHMEMX_HEAP_HIST_BUCKETS];
+} ishmemx_heap_info_t;
+
 /* ISHMEMX APIs */
 /* Library setup and query routines (host) */
 void ishmemx_init_attr(ishmemx_attr_t *attr);
 ishmemx_runtime_type_t ishmemx_runtime_get_type();
 void ishmemx_query_initialized(int *initialized);
 
+/* Memory management routines (host) */
+int ishmemx_heap_info(ishmemx_heap_info_t *info);
+
 /* clang-format off */
 /* put_on_queue */
 template <typename T> sycl::event ishmemx_put_on_queue(T *, const T *, size_t, int, sycl::queue &, const std::vector<sycl::event> & = {});
@@ -845,6 +864,276 @@ template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoall_wor
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoall_work_group(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, size_t, const Group &);
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallmem_work_group(ishmem_team_t, void *, const void *, size_t, const Group &);
 
+/* alltoalls_on_queue */
+template <typename T> sycl::event ishmemx_alltoalls_on_queue(T *, const T *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_float_alltoalls_on_queue(float *, const float *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_double_alltoalls_on_queue(double *, const double *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_char_alltoalls_on_queue(char *, const char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_schar_alltoalls_on_queue(signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_short_alltoalls_on_queue(short *, const short *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int_alltoalls_on_queue(int *, const int *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_long_alltoalls_on_queue(long *, const long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_longlong_alltoalls_on_queue(long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uchar_alltoalls_on_queue(unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ushort_alltoalls_on_queue(unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint_alltoalls_on_queue(unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulong_alltoalls_on_queue(unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulonglong_alltoalls_on_queue(unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int8_alltoalls_on_queue(int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int16_alltoalls_on_queue(int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int32_alltoalls_on_queue(int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int64_alltoalls_on_queue(int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint8_alltoalls_on_queue(uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint16_alltoalls_on_queue(uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint32_alltoalls_on_queue(uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint64_alltoalls_on_queue(uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_size_alltoalls_on_queue(size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ptrdiff_alltoalls_on_queue(ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_alltoallsmem_on_queue(void *, const void *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+
+/* alltoalls_on_queue on a team */
+template <typename T> sycl::event ishmemx_alltoalls_on_queue(ishmem_team_t, T *, const T *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_float_alltoalls_on_queue(ishmem_team_t, float *, const float *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_double_alltoalls_on_queue(ishmem_team_t, double *, const double *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_char_alltoalls_on_queue(ishmem_team_t, char *, const char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_schar_alltoalls_on_queue(ishmem_team_t, signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_short_alltoalls_on_queue(ishmem_team_t, short *, const short *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int_alltoalls_on_queue(ishmem_team_t, int *, const int *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_long_alltoalls_on_queue(ishmem_team_t, long *, const long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_longlong_alltoalls_on_queue(ishmem_team_t, long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uchar_alltoalls_on_queue(ishmem_team_t, unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ushort_alltoalls_on_queue(ishmem_team_t, unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint_alltoalls_on_queue(ishmem_team_t, unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulong_alltoalls_on_queue(ishmem_team_t, unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulonglong_alltoalls_on_queue(ishmem_team_t, unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int8_alltoalls_on_queue(ishmem_team_t, int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int16_alltoalls_on_queue(ishmem_team_t, int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int32_alltoalls_on_queue(ishmem_team_t, int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int64_alltoalls_on_queue(ishmem_team_t, int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint8_alltoalls_on_queue(ishmem_team_t, uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint16_alltoalls_on_queue(ishmem_team_t, uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint32_alltoalls_on_queue(ishmem_team_t, uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint64_alltoalls_on_queue(ishmem_team_t, uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_size_alltoalls_on_queue(ishmem_team_t, size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ptrdiff_alltoalls_on_queue(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_alltoallsmem_on_queue(ishmem_team_t, void *, const void *, ptrdiff_t, ptrdiff_t, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+
+/* alltoalls_work_group */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoalls_work_group(T *, const T *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoalls_work_group(float *, const float *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoalls_work_group(double *, const double *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoalls_work_group(char *, const char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoalls_work_group(signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoalls_work_group(short *, const short *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoalls_work_group(int *, const int *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoalls_work_group(long *, const long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoalls_work_group(long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoalls_work_group(unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoalls_work_group(unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoalls_work_group(unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoalls_work_group(unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoalls_work_group(unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoalls_work_group(int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoalls_work_group(int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoalls_work_group(int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoalls_work_group(int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoalls_work_group(uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoalls_work_group(uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoalls_work_group(uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoalls_work_group(uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoalls_work_group(size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoalls_work_group(ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallsmem_work_group(void *, const void *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+
+/* alltoalls_work_group on a team */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoalls_work_group(ishmem_team_t, T *, const T *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoalls_work_group(ishmem_team_t, float *, const float *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoalls_work_group(ishmem_team_t, double *, const double *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoalls_work_group(ishmem_team_t, char *, const char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoalls_work_group(ishmem_team_t, signed char *, const signed char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoalls_work_group(ishmem_team_t, short *, const short *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoalls_work_group(ishmem_team_t, int *, const int *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoalls_work_group(ishmem_team_t, long *, const long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoalls_work_group(ishmem_team_t, long long *, const long long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoalls_work_group(ishmem_team_t, unsigned char *, const unsigned char *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoalls_work_group(ishmem_team_t, unsigned short *, const unsigned short *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoalls_work_group(ishmem_team_t, unsigned int *, const unsigned int *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoalls_work_group(ishmem_team_t, unsigned long *, const unsigned long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoalls_work_group(ishmem_team_t, unsigned long long *, const unsigned long long *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoalls_work_group(ishmem_team_t, int8_t *, const int8_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoalls_work_group(ishmem_team_t, int16_t *, const int16_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoalls_work_group(ishmem_team_t, int32_t *, const int32_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoalls_work_group(ishmem_team_t, int64_t *, const int64_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoalls_work_group(ishmem_team_t, uint8_t *, const uint8_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoalls_work_group(ishmem_team_t, uint16_t *, const uint16_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoalls_work_group(ishmem_team_t, uint32_t *, const uint32_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoalls_work_group(ishmem_team_t, uint64_t *, const uint64_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoalls_work_group(ishmem_team_t, size_t *, const size_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoalls_work_group(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallsmem_work_group(ishmem_team_t, void *, const void *, ptrdiff_t, ptrdiff_t, size_t, const Group &);
+
+/* alltoallv */
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallv(T *, const size_t *, const T *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoallv(float *, const size_t *, const float *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoallv(double *, const size_t *, const double *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoallv(char *, const size_t *, const char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoallv(signed char *, const size_t *, const signed char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoallv(short *, const size_t *, const short *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoallv(int *, const size_t *, const int *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoallv(long *, const size_t *, const long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoallv(long long *, const size_t *, const long long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoallv(unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoallv(unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoallv(unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoallv(unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoallv(unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoallv(int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoallv(int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoallv(int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoallv(int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoallv(uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoallv(uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoallv(uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoallv(uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoallv(size_t *, const size_t *, const size_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoallv(ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallvmem(void *, const size_t *, const void *, const size_t *, const size_t *);
+
+/* alltoallv on a team */
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallv(ishmem_team_t, T *, const size_t *, const T *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoallv(ishmem_team_t, float *, const size_t *, const float *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoallv(ishmem_team_t, double *, const size_t *, const double *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoallv(ishmem_team_t, char *, const size_t *, const char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoallv(ishmem_team_t, signed char *, const size_t *, const signed char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoallv(ishmem_team_t, short *, const size_t *, const short *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoallv(ishmem_team_t, int *, const size_t *, const int *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoallv(ishmem_team_t, long *, const size_t *, const long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoallv(ishmem_team_t, long long *, const size_t *, const long long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoallv(ishmem_team_t, unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoallv(ishmem_team_t, unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoallv(ishmem_team_t, unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoallv(ishmem_team_t, unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoallv(ishmem_team_t, unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoallv(ishmem_team_t, int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoallv(ishmem_team_t, int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoallv(ishmem_team_t, int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoallv(ishmem_team_t, int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoallv(ishmem_team_t, uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoallv(ishmem_team_t, uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoallv(ishmem_team_t, uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoallv(ishmem_team_t, uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoallv(ishmem_team_t, size_t *, const size_t *, const size_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoallv(ishmem_team_t, ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallvmem(ishmem_team_t, void *, const size_t *, const void *, const size_t *, const size_t *);
+
+/* alltoallv_on_queue */
+template <typename T> sycl::event ishmemx_alltoallv_on_queue(T *, const size_t *, const T *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_float_alltoallv_on_queue(float *, const size_t *, const float *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_double_alltoallv_on_queue(double *, const size_t *, const double *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_char_alltoallv_on_queue(char *, const size_t *, const char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_schar_alltoallv_on_queue(signed char *, const size_t *, const signed char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_short_alltoallv_on_queue(short *, const size_t *, const short *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int_alltoallv_on_queue(int *, const size_t *, const int *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_long_alltoallv_on_queue(long *, const size_t *, const long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_longlong_alltoallv_on_queue(long long *, const size_t *, const long long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uchar_alltoallv_on_queue(unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ushort_alltoallv_on_queue(unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint_alltoallv_on_queue(unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulong_alltoallv_on_queue(unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulonglong_alltoallv_on_queue(unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int8_alltoallv_on_queue(int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int16_alltoallv_on_queue(int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int32_alltoallv_on_queue(int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int64_alltoallv_on_queue(int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint8_alltoallv_on_queue(uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint16_alltoallv_on_queue(uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint32_alltoallv_on_queue(uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint64_alltoallv_on_queue(uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_size_alltoallv_on_queue(size_t *, const size_t *, const size_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ptrdiff_alltoallv_on_queue(ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_alltoallvmem_on_queue(void *, const size_t *, const void *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+
+/* alltoallv_on_queue on a team */
+template <typename T> sycl::event ishmemx_alltoallv_on_queue(ishmem_team_t, T *, const size_t *, const T *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_float_alltoallv_on_queue(ishmem_team_t, float *, const size_t *, const float *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_double_alltoallv_on_queue(ishmem_team_t, double *, const size_t *, const double *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_char_alltoallv_on_queue(ishmem_team_t, char *, const size_t *, const char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_schar_alltoallv_on_queue(ishmem_team_t, signed char *, const size_t *, const signed char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_short_alltoallv_on_queue(ishmem_team_t, short *, const size_t *, const short *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int_alltoallv_on_queue(ishmem_team_t, int *, const size_t *, const int *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_long_alltoallv_on_queue(ishmem_team_t, long *, const size_t *, const long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_longlong_alltoallv_on_queue(ishmem_team_t, long long *, const size_t *, const long long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uchar_alltoallv_on_queue(ishmem_team_t, unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ushort_alltoallv_on_queue(ishmem_team_t, unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint_alltoallv_on_queue(ishmem_team_t, unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulong_alltoallv_on_queue(ishmem_team_t, unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ulonglong_alltoallv_on_queue(ishmem_team_t, unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int8_alltoallv_on_queue(ishmem_team_t, int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int16_alltoallv_on_queue(ishmem_team_t, int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int32_alltoallv_on_queue(ishmem_team_t, int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_int64_alltoallv_on_queue(ishmem_team_t, int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint8_alltoallv_on_queue(ishmem_team_t, uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint16_alltoallv_on_queue(ishmem_team_t, uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint32_alltoallv_on_queue(ishmem_team_t, uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_uint64_alltoallv_on_queue(ishmem_team_t, uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_size_alltoallv_on_queue(ishmem_team_t, size_t *, const size_t *, const size_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_ptrdiff_alltoallv_on_queue(ishmem_team_t, ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+sycl::event ishmemx_alltoallvmem_on_queue(ishmem_team_t, void *, const size_t *, const void *, const size_t *, const size_t *, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+
+/* alltoallv_work_group */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallv_work_group(T *, const size_t *, const T *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoallv_work_group(float *, const size_t *, const float *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoallv_work_group(double *, const size_t *, const double *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoallv_work_group(char *, const size_t *, const char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoallv_work_group(signed char *, const size_t *, const signed char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoallv_work_group(short *, const size_t *, const short *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoallv_work_group(int *, const size_t *, const int *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoallv_work_group(long *, const size_t *, const long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoallv_work_group(long long *, const size_t *, const long long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoallv_work_group(unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoallv_work_group(unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoallv_work_group(unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoallv_work_group(unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoallv_work_group(unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoallv_work_group(int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoallv_work_group(int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoallv_work_group(int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoallv_work_group(int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoallv_work_group(uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoallv_work_group(uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoallv_work_group(uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoallv_work_group(uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoallv_work_group(size_t *, const size_t *, const size_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoallv_work_group(ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallvmem_work_group(void *, const size_t *, const void *, const size_t *, const size_t *, const Group &);
+
+/* alltoallv_work_group on a team */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallv_work_group(ishmem_team_t, T *, const size_t *, const T *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_alltoallv_work_group(ishmem_team_t, float *, const size_t *, const float *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_alltoallv_work_group(ishmem_team_t, double *, const size_t *, const double *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_alltoallv_work_group(ishmem_team_t, char *, const size_t *, const char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_alltoallv_work_group(ishmem_team_t, signed char *, const size_t *, const signed char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_alltoallv_work_group(ishmem_team_t, short *, const size_t *, const short *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_alltoallv_work_group(ishmem_team_t, int *, const size_t *, const int *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_alltoallv_work_group(ishmem_team_t, long *, const size_t *, const long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_alltoallv_work_group(ishmem_team_t, long long *, const size_t *, const long long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_alltoallv_work_group(ishmem_team_t, unsigned char *, const size_t *, const unsigned char *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_alltoallv_work_group(ishmem_team_t, unsigned short *, const size_t *, const unsigned short *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_alltoallv_work_group(ishmem_team_t, unsigned int *, const size_t *, const unsigned int *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_alltoallv_work_group(ishmem_team_t, unsigned long *, const size_t *, const unsigned long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_alltoallv_work_group(ishmem_team_t, unsigned long long *, const size_t *, const unsigned long long *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_alltoallv_work_group(ishmem_team_t, int8_t *, const size_t *, const int8_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_alltoallv_work_group(ishmem_team_t, int16_t *, const size_t *, const int16_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_alltoallv_work_group(ishmem_team_t, int32_t *, const size_t *, const int32_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_alltoallv_work_group(ishmem_team_t, int64_t *, const size_t *, const int64_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_alltoallv_work_group(ishmem_team_t, uint8_t *, const size_t *, const uint8_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_alltoallv_work_group(ishmem_team_t, uint16_t *, const size_t *, const uint16_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_alltoallv_work_group(ishmem_team_t, uint32_t *, const size_t *, const uint32_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_alltoallv_work_group(ishmem_team_t, uint64_t *, const size_t *, const uint64_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_alltoallv_work_group(ishmem_team_t, size_t *, const size_t *, const size_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_alltoallv_work_group(ishmem_team_t, ptrdiff_t *, const size_t *, const ptrdiff_t *, const size_t *, const size_t *, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallvmem_work_group(ishmem_team_t, void *, const size_t *, const void *, const size_t *, const size_t *, const Group &);
+
 /* broadcast_on_queue */
 template <typename T> sycl::event ishmemx_broadcast_on_queue(T *, const T *, size_t, int, int *, sycl::queue &, const std::vector<sycl::event> & = {});
 sycl::event ishmemx_float_broadcast_on_queue(float *, const float *, size_t, int, int *, sycl::queue &, const std::vector<sycl::event> & = {});
@@ -1903,6 +2192,108 @@ sycl::event ishmemx_uint64_sum_exscan_on_queue(ishmem_team_t, uint64_t *, const
 sycl::event ishmemx_size_sum_exscan_on_queue(ishmem_team_t, size_t *, const size_t *, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
 sycl::event ishmemx_ptrdiff_sum_exscan_on_queue(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, size_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
 
+/* scan_work_group (prefix sum) */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_sum_inscan_work_group(T *, const T *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_sum_inscan_work_group(float *, const float *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_sum_inscan_work_group(double *, const double *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_sum_inscan_work_group(char *, const char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_sum_inscan_work_group(signed char *, const signed char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_sum_inscan_work_group(short *, const short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_sum_inscan_work_group(int *, const int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_sum_inscan_work_group(long *, const long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_sum_inscan_work_group(long long *, const long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_sum_inscan_work_group(unsigned char *, const unsigned char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_sum_inscan_work_group(unsigned short *, const unsigned short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_sum_inscan_work_group(unsigned int *, const unsigned int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_sum_inscan_work_group(unsigned long *, const unsigned long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_sum_inscan_work_group(unsigned long long *, const unsigned long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_sum_inscan_work_group(int8_t *, const int8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_sum_inscan_work_group(int16_t *, const int16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_sum_inscan_work_group(int32_t *, const int32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_sum_inscan_work_group(int64_t *, const int64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_sum_inscan_work_group(uint8_t *, const uint8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_sum_inscan_work_group(uint16_t *, const uint16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_sum_inscan_work_group(uint32_t *, const uint32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_sum_inscan_work_group(uint64_t *, const uint64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_sum_inscan_work_group(size_t *, const size_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_sum_inscan_work_group(ptrdiff_t *, const ptrdiff_t *, size_t, const Group &);
+
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_sum_exscan_work_group(T *, const T *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_sum_exscan_work_group(float *, const float *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_sum_exscan_work_group(double *, const double *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_sum_exscan_work_group(char *, const char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_sum_exscan_work_group(signed char *, const signed char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_sum_exscan_work_group(short *, const short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_sum_exscan_work_group(int *, const int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_sum_exscan_work_group(long *, const long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_sum_exscan_work_group(long long *, const long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_sum_exscan_work_group(unsigned char *, const unsigned char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_sum_exscan_work_group(unsigned short *, const unsigned short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_sum_exscan_work_group(unsigned int *, const unsigned int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_sum_exscan_work_group(unsigned long *, const unsigned long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_sum_exscan_work_group(unsigned long long *, const unsigned long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_sum_exscan_work_group(int8_t *, const int8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_sum_exscan_work_group(int16_t *, const int16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_sum_exscan_work_group(int32_t *, const int32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_sum_exscan_work_group(int64_t *, const int64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_sum_exscan_work_group(uint8_t *, const uint8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_sum_exscan_work_group(uint16_t *, const uint16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_sum_exscan_work_group(uint32_t *, const uint32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_sum_exscan_work_group(uint64_t *, const uint64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_sum_exscan_work_group(size_t *, const size_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_sum_exscan_work_group(ptrdiff_t *, const ptrdiff_t *, size_t, const Group &);
+
+/* scan_work_group (prefix sum) on a team */
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_sum_inscan_work_group(ishmem_team_t, T *, const T *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_sum_inscan_work_group(ishmem_team_t, float *, const float *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_sum_inscan_work_group(ishmem_team_t, double *, const double *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_sum_inscan_work_group(ishmem_team_t, char *, const char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_sum_inscan_work_group(ishmem_team_t, signed char *, const signed char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_sum_inscan_work_group(ishmem_team_t, short *, const short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_sum_inscan_work_group(ishmem_team_t, int *, const int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_sum_inscan_work_group(ishmem_team_t, long *, const long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_sum_inscan_work_group(ishmem_team_t, long long *, const long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_sum_inscan_work_group(ishmem_team_t, unsigned char *, const unsigned char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_sum_inscan_work_group(ishmem_team_t, unsigned short *, const unsigned short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_sum_inscan_work_group(ishmem_team_t, unsigned int *, const unsigned int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_sum_inscan_work_group(ishmem_team_t, unsigned long *, const unsigned long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_sum_inscan_work_group(ishmem_team_t, unsigned long long *, const unsigned long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_sum_inscan_work_group(ishmem_team_t, int8_t *, const int8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_sum_inscan_work_group(ishmem_team_t, int16_t *, const int16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_sum_inscan_work_group(ishmem_team_t, int32_t *, const int32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_sum_inscan_work_group(ishmem_team_t, int64_t *, const int64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_sum_inscan_work_group(ishmem_team_t, uint8_t *, const uint8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_sum_inscan_work_group(ishmem_team_t, uint16_t *, const uint16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_sum_inscan_work_group(ishmem_team_t, uint32_t *, const uint32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_sum_inscan_work_group(ishmem_team_t, uint64_t *, const uint64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_sum_inscan_work_group(ishmem_team_t, size_t *, const size_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_sum_inscan_work_group(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, size_t, const Group &);
+
+template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_sum_exscan_work_group(ishmem_team_t, T *, const T *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_float_sum_exscan_work_group(ishmem_team_t, float *, const float *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_double_sum_exscan_work_group(ishmem_team_t, double *, const double *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_char_sum_exscan_work_group(ishmem_team_t, char *, const char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_schar_sum_exscan_work_group(ishmem_team_t, signed char *, const signed char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_short_sum_exscan_work_group(ishmem_team_t, short *, const short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_sum_exscan_work_group(ishmem_team_t, int *, const int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_long_sum_exscan_work_group(ishmem_team_t, long *, const long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_longlong_sum_exscan_work_group(ishmem_team_t, long long *, const long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uchar_sum_exscan_work_group(ishmem_team_t, unsigned char *, const unsigned char *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ushort_sum_exscan_work_group(ishmem_team_t, unsigned short *, const unsigned short *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint_sum_exscan_work_group(ishmem_team_t, unsigned int *, const unsigned int *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulong_sum_exscan_work_group(ishmem_team_t, unsigned long *, const unsigned long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ulonglong_sum_exscan_work_group(ishmem_team_t, unsigned long long *, const unsigned long long *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int8_sum_exscan_work_group(ishmem_team_t, int8_t *, const int8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int16_sum_exscan_work_group(ishmem_team_t, int16_t *, const int16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int32_sum_exscan_work_group(ishmem_team_t, int32_t *, const int32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int64_sum_exscan_work_group(ishmem_team_t, int64_t *, const int64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint8_sum_exscan_work_group(ishmem_team_t, uint8_t *, const uint8_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint16_sum_exscan_work_group(ishmem_team_t, uint16_t *, const uint16_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint32_sum_exscan_work_group(ishmem_team_t, uint32_t *, const uint32_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_uint64_sum_exscan_work_group(ishmem_team_t, uint64_t *, const uint64_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_size_sum_exscan_work_group(ishmem_team_t, size_t *, const size_t *, size_t, const Group &);
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_ptrdiff_sum_exscan_work_group(ishmem_team_t, ptrdiff_t *, const ptrdiff_t *, size_t, const Group &);
+
 /* test_work_group */
 template <typename T, typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_test_work_group(T *, int, T, const Group &);
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_int_test_work_group(int *, int, int, const Group &);
@@ -2238,6 +2629,55 @@ sycl::event ishmemx_team_sync_on_queue(ishmem_team_t, int *, sycl::queue &, cons
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES void ishmemx_sync_all_work_group(const Group &);
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES void ishmemx_team_sync_work_group(ishmem_team_t, const Group &);
 
+/* Collective plans: a collective's team, buffers and sizes captured once and executed many times */
+typedef struct ishmemi_plan_t *ishmemx_plan_t;
+
+/* plan_create (host, collective over the team) */
+int ishmemx_alltoallmem_plan_create(ishmem_team_t, void *, const void *, size_t, ishmemx_plan_t *);
+int ishmemx_broadcastmem_plan_create(ishmem_team_t, void *, const void *, size_t, int, ishmemx_plan_t *);
+int ishmemx_collectmem_plan_create(ishmem_team_t, void *, const void *, size_t, ishmemx_plan_t *);
+int ishmemx_fcollectmem_plan_create(ishmem_team_t, void *, const void *, size_t, ishmemx_plan_t *);
+template <typename T> inline int ishmemx_alltoall_plan_create(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_plan_t *plan) { return ishmemx_alltoallmem_plan_create(team, dest, src, nelems * sizeof(T), plan); }
+template <typename T> inline int ishmemx_broadcast_plan_create(ishmem_team_t team, T *dest, const T *src, size_t nelems, int root, ishmemx_plan_t *plan) { return ishmemx_broadcastmem_plan_create(team, dest, src, nelems * sizeof(T), root, plan); }
+template <typename T> inline int ishmemx_collect_plan_create(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_plan_t *plan) { return ishmemx_collectmem_plan_create(team, dest, src, nelems * sizeof(T), plan); }
+template <typename T> inline int ishmemx_fcollect_plan_create(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_plan_t *plan) { return ishmemx_fcollectmem_plan_create(team, dest, src, nelems * sizeof(T), plan); }
+
+/* plan_execute */
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_plan_execute(ishmemx_plan_t);
+sycl::event ishmemx_plan_execute_on_queue(ishmemx_plan_t, int *, sycl::queue &, const std::vector<sycl::event> & = {});
+template <typename Group> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_plan_execute_work_group(ishmemx_plan_t, const Group &);
+
+/* plan_destroy (host) */
+int ishmemx_plan_destroy(ishmemx_plan_t);
+
+/* Nonblocking collectives: each one returns a handle that coll_test or coll_wait completes on the
+ * same side (host or device) that started it.  A null handle means the collective completed */
+typedef uint64_t ishmemx_coll_handle_t;
+#define ISHMEMX_COLL_HANDLE_NULL ((ishmemx_coll_handle_t) 0)
+
+/* alltoall_nb, broadcast_nb, collect_nb, fcollect_nb */
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_alltoallmem_nb(ishmem_team_t, void *, const void *, size_t, ishmemx_coll_handle_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_broadcastmem_nb(ishmem_team_t, void *, const void *, size_t, int, ishmemx_coll_handle_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_collectmem_nb(ishmem_team_t, void *, const void *, size_t, ishmemx_coll_handle_t *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_fcollectmem_nb(ishmem_team_t, void *, const void *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES inline int ishmemx_alltoall_nb(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_coll_handle_t *handle) { return ishmemx_alltoallmem_nb(team, dest, src, nelems * sizeof(T), handle); }
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES inline int ishmemx_broadcast_nb(ishmem_team_t team, T *dest, const T *src, size_t nelems, int PE_root, ishmemx_coll_handle_t *handle) { return ishmemx_broadcastmem_nb(team, dest, src, nelems * sizeof(T), PE_root, handle); }
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES inline int ishmemx_collect_nb(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_coll_handle_t *handle) { return ishmemx_collectmem_nb(team, dest, src, nelems * sizeof(T), handle); }
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES inline int ishmemx_fcollect_nb(ishmem_team_t team, T *dest, const T *src, size_t nelems, ishmemx_coll_handle_t *handle) { return ishmemx_fcollectmem_nb(team, dest, src, nelems * sizeof(T), handle); }
+
+/* reduce_nb */
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_and_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_or_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_xor_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_max_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_min_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_sum_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+template <typename T> ISHMEM_DEVICE_ATTRIBUTES int ishmemx_prod_reduce_nb(ishmem_team_t, T *, const T *, size_t, ishmemx_coll_handle_t *);
+
+/* coll_test returns 1 once the collective completed, with its return value in the status */
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_coll_test(ishmemx_coll_handle_t *, int *);
+ISHMEM_DEVICE_ATTRIBUTES int ishmemx_coll_wait(ishmemx_coll_handle_t *);
+
 /* fence_work_group */
 template <typename Group> ISHMEM_DEVICE_ATTRIBUTES void ishmemx_fence_work_group(const Group &);
 
@@ -537,6 +537,7 @@ MAX_RELEASE_CHECK_RATE   default: 4095 unless not HAVE_MMAP
 #include "memory.h"
 
 #define ONLY_MSPACES 1
+#define MALLOC_INSPECT_ALL 1
 #define HAVE_MMAP 0
 #define HAVE_MREMAP 0
 #define USAGE_ERROR_ACTION(m, p)                                        \
@@ -12,6 +12,13 @@ namespace {
     /* Private immediate command list for copying data */
     ze_command_list_handle_t copy_list = {};
 
+    /* Asynchronous copies: each slot has an event signaled by its copy, and a command list that
+     * is reset and reused for every copy of the slot once the previous one was waited on */
+    ze_event_pool_handle_t copy_async_pool = {};
+    ze_event_handle_t copy_async_events[ISHMEMI_COPY_ASYNC_SLOTS] = {};
+    ze_command_list_handle_t copy_async_lists[ISHMEMI_COPY_ASYNC_SLOTS] = {};
+    bool copy_async_busy[ISHMEMI_COPY_ASYNC_SLOTS] = {};
+
     /* IPC handles for mmap regions */
     ze_ipc_mem_handle_t heap_handle = {};
     ze_ipc_mem_handle_t info_handle = {};
@@ -19,6 +26,47 @@ namespace {
     /* Heap vars */
     mspace ishmemi_mspace;
     char *heap_curr = nullptr;
+
+    /* Heap usage counters, maintained by ishmemi_alloc and ishmemi_free */
+    size_t heap_bytes_in_use = 0;
+    size_t heap_peak_bytes_in_use = 0;
+    size_t heap_num_allocations = 0;
+    size_t heap_histogram[ISHMEMX_HEAP_HIST_BUCKETS] = {};
+
+    /* Free space summary gathered by walking the dlmalloc chunks */
+    struct heap_walk_t {
+        size_t bytes_free;
+        size_t largest_free_block;
+        size_t num_free_segments;
+    };
+
+    void heap_walk_handler(void *start, void *end, size_t used_bytes, void *arg)
+    {
+        if (used_bytes != 0) return;
+
+        heap_walk_t *walk = static_cast<heap_walk_t *>(arg);
+        size_t len = ((uintptr_t) end) - ((uintptr_t) start);
+        walk->bytes_free += len;
+        walk->num_free_segments += 1;
+        if (len > walk->largest_free_block) walk->largest_free_block = len;
+    }
+
+    inline void heap_record_alloc(size_t size, size_t usable)
+    {
+        size_t bucket = static_cast<size_t>(63 - __builtin_clzl(size));
+        if (bucket >= ISHMEMX_HEAP_HIST_BUCKETS) bucket = ISHMEMX_HEAP_HIST_BUCKETS - 1;
+        heap_histogram[bucket] += 1;
+
+        heap_num_allocations += 1;
+        heap_bytes_in_use += usable;
+        if (heap_bytes_in_use > heap_peak_bytes_in_use) heap_peak_bytes_in_use = heap_bytes_in_use;
+    }
+
+    inline void heap_record_free(size_t usable)
+    {
+        heap_num_allocations -= 1;
+        heap_bytes_in_use -= usable;
+    }
 }  // namespace
 
 /* Heap var */
@@ -35,6 +83,7 @@ ishmemi_info_t *ishmemi_mmap_gpu_info = nullptr;
 int ishmemi_memory_init()
 {
     int ret = 0;
+    ze_event_pool_desc_t event_pool_desc;
 
     ISHMEM_DEBUG_MSG("Symmetric heap size %ld\n", ishmemi_params.SYMMETRIC_SIZE);
     ishmemi_heap_length = ishmemi_params.SYMMETRIC_SIZE + ISHMEMI_HEAP_OVERHEAD;
@@ -124,6 +173,30 @@ int ishmemi_memory_init()
     ret = ishmemi_create_command_list(COPY_QUEUE, true, &copy_list);
     ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
 
+    /* create the events for ishmemi_copy_async */
+    event_pool_desc = {
+        .stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        .pNext = nullptr,
+        .flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        .count = ISHMEMI_COPY_ASYNC_SLOTS,
+    };
+    ZE_CHECK(zeEventPoolCreate(ishmemi_ze_context, &event_pool_desc, 0, nullptr, &copy_async_pool));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+    for (uint32_t i = 0; i < ISHMEMI_COPY_ASYNC_SLOTS; i++) {
+        ze_event_desc_t event_desc = {
+            .stype = ZE_STRUCTURE_TYPE_EVENT_DESC,
+            .pNext = nullptr,
+            .index = i,
+            .signal = ZE_EVENT_SCOPE_FLAG_HOST,
+            .wait = ZE_EVENT_SCOPE_FLAG_HOST,
+        };
+        ZE_CHECK(zeEventCreate(copy_async_pool, &event_desc, &copy_async_events[i]));
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+        ret = ishmemi_create_command_list(COPY_QUEUE, false, &copy_async_lists[i]);
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+        copy_async_busy[i] = false;
+    }
+
 fn_exit:
     return ret;
 fn_fail:
@@ -157,6 +230,15 @@ int ishmemi_memory_fini()
     ZE_CHECK(zeCommandListDestroy(copy_list));
     ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
+    for (int i = 0; i < ISHMEMI_COPY_ASYNC_SLOTS; i++) {
+        ishmemi_copy_async_wait(i);
+        ZE_CHECK(zeCommandListDestroy(copy_async_lists[i]));
+        copy_async_lists[i] = nullptr;
+        ZE_CHECK(zeEventDestroy(copy_async_events[i]));
+    }
+    ZE_CHECK(zeEventPoolDestroy(copy_async_pool));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
     ret = ishmemi_usm_free(ishmemi_gpu_info);
     ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
@@ -214,6 +296,7 @@ void *ishmemi_alloc(size_t size, size_t alignment)
         ret = mspace_memalign(ishmemi_mspace, alignment, size);
         ISHMEM_CHECK_GOTO_MSG(ret == nullptr, fn_fail,
                               "Unable to allocate %zu bytes in symmetric heap\n", size);
+        heap_record_alloc(size, mspace_usable_size(ret));
 #else
         ISHMEM_CHECK_GOTO_MSG(ret == nullptr, fn_fail,
                               "Host-accessibly heap requires dlmalloc to be enabled\n", size);
@@ -223,11 +306,13 @@ void *ishmemi_alloc(size_t size, size_t alignment)
         host_ret = mspace_memalign(ishmemi_mspace, alignment, size);
         ISHMEM_CHECK_GOTO_MSG(host_ret == nullptr, fn_fail,
                               "Unable to allocate %zu bytes in symmetric heap\n", size);
+        heap_record_alloc(size, mspace_usable_size(host_ret));
 
         ret = (void *) (((uintptr_t) host_ret - (uintptr_t) ishmemi_mmap_heap_base) +
                         (uintptr_t) ishmemi_heap_base);
 #else
         ret = ishmemi_get_next(size);
+        if (ret != nullptr) heap_record_alloc(size, size);
 #endif
     }
 
@@ -287,6 +372,7 @@ void ishmemi_free(void *ptr)
     if (ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP) {
         if (ptr != nullptr) {
 #ifdef ENABLE_DLMALLOC
+            heap_record_free(mspace_usable_size(ptr));
             mspace_free(ishmemi_mspace, ptr);
 #endif
         }
@@ -295,12 +381,76 @@ void ishmemi_free(void *ptr)
 #ifdef ENABLE_DLMALLOC
             void *host_ptr = (void *) (((uintptr_t) ptr - (uintptr_t) ishmemi_heap_base) +
                                        (uintptr_t) ishmemi_mmap_heap_base);
+            heap_record_free(mspace_usable_size(host_ptr));
             mspace_free(ishmemi_mspace, host_ptr);
 #endif
         }
     }
 }
 
+int ishmemx_heap_info(ishmemx_heap_info_t *info)
+{
+    if constexpr (enable_error_checking) validate_init();
+
+    int ret = 0;
+
+    ISHMEM_CHECK_GOTO_MSG(info == nullptr, fn_fail, "Invalid heap info argument\n");
+
+    info->heap_size = ishmemi_heap_length;
+    info->bytes_in_use = heap_bytes_in_use;
+    info->peak_bytes_in_use = heap_peak_bytes_in_use;
+    info->num_allocations = heap_num_allocations;
+    for (size_t i = 0; i < ISHMEMX_HEAP_HIST_BUCKETS; i++) {
+        info->histogram[i] = heap_histogram[i];
+    }
+
+#ifdef ENABLE_DLMALLOC
+    {
+        heap_walk_t walk = {};
+        mspace_inspect_all(ishmemi_mspace, heap_walk_handler, &walk);
+        info->bytes_free = walk.bytes_free;
+        info->largest_free_block = walk.largest_free_block;
+        info->num_free_segments = walk.num_free_segments;
+    }
+#else
+    /* The sbrk style allocator never frees, so the only free region is the tail of the heap */
+    info->bytes_free = ishmemi_heap_length - (size_t) (heap_curr - (char *) ishmemi_heap_base);
+    info->largest_free_block = info->bytes_free;
+    info->num_free_segments = (info->bytes_free != 0) ? 1 : 0;
+#endif
+
+fn_exit:
+    return ret;
+fn_fail:
+    ret = 1;
+    goto fn_exit;
+}
+
+void ishmemi_memory_report()
+{
+    ishmemx_heap_info_t info;
+    int ret = ishmemx_heap_info(&info);
+    if (ret) return;
+
+    char str[ISHMEMI_DIAG_STRLEN];
+    size_t off = 0;
+    off += (size_t) snprintf(str + off, sizeof(str) - off,
+                             "[%04d] HEAP: size %zu in_use %zu peak %zu free %zu largest_free %zu "
+                             "free_segments %zu allocations %zu\n",
+                             ishmemi_my_pe, info.heap_size, info.bytes_in_use,
+                             info.peak_bytes_in_use, info.bytes_free, info.largest_free_block,
+                             info.num_free_segments, info.num_allocations);
+    off += (size_t) snprintf(str + off, sizeof(str) - off, RAISE_PE_PREFIX "size histogram:",
+                             ishmemi_my_pe);
+    for (size_t i = 0; i < ISHMEMX_HEAP_HIST_BUCKETS && off < sizeof(str); i++) {
+        if (info.histogram[i] == 0) continue;
+        off += (size_t) snprintf(str + off, sizeof(str) - off, " [2^%zu]=%zu", i,
+                                 info.histogram[i]);
+    }
+    if (off < sizeof(str)) snprintf(str + off, sizeof(str) - off, "\n");
+    fprintf(stderr, "%s", str);
+}
+
 void *ishmem_copy(void *dest, const void *src, size_t size)
 {
     if constexpr (enable_error_checking) validate_init();
@@ -320,6 +470,52 @@ fn_fail:
     return nullptr;
 }
 
+std::mutex ishmemi_copy_async_mtx;
+
+int ishmemi_copy_async(void *dest, const void *src, size_t size, int slot)
+{
+    int ret = 0;
+    ze_command_list_handle_t cmd_list = copy_async_lists[slot];
+
+    ISHMEM_CHECK_RETURN_MSG(copy_async_busy[slot], "Copy slot %d is still in use\n", slot);
+
+    ZE_CHECK(zeEventHostReset(copy_async_events[slot]));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    ZE_CHECK(zeCommandListReset(cmd_list));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    ZE_CHECK(zeCommandListAppendMemoryCopy(cmd_list, dest, src, size, copy_async_events[slot], 0,
+                                           nullptr));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    ZE_CHECK(zeCommandListClose(cmd_list));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    ret = ishmemi_execute_command_lists(COPY_QUEUE, 1, &cmd_list);
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    copy_async_busy[slot] = true;
+
+fn_exit:
+    return ret;
+}
+
+int ishmemi_copy_async_wait(int slot)
+{
+    int ret = 0;
+
+    if (!copy_async_busy[slot]) return 0;
+
+    ZE_CHECK(zeEventHostSynchronize(copy_async_events[slot], UINT64_MAX));
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
+    copy_async_busy[slot] = false;
+
+fn_exit:
+    return ret;
+}
+
 void *ishmem_zero(void *dest, size_t size)
 {
     if constexpr (enable_error_checking) validate_init();
@@ -7,10 +7,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 
 #define ISHMEMI_HEAP_OVERHEAD 1024
 #define ISHMEMI_ALLOC_ALIGN   ((size_t) 64)
 
+/* Number of asynchronous copies that may be in flight at once */
+#define ISHMEMI_COPY_ASYNC_SLOTS 4
+
 /* dlmalloc definitions */
 extern "C" {
 typedef void *mspace;
@@ -18,6 +22,8 @@ typedef void *mspace;
 mspace create_mspace_with_base(void *, size_t, int);
 void *mspace_memalign(mspace, size_t, size_t);
 void mspace_free(mspace, void *);
+size_t mspace_usable_size(const void *);
+void mspace_inspect_all(mspace, void (*)(void *, void *, size_t, void *), void *);
 }
 
 /* Memory routines */
@@ -28,8 +34,16 @@ void *ishmemi_alloc(size_t, size_t alignment = ISHMEMI_ALLOC_ALIGN);
 void *ishmemi_calloc(size_t count, size_t);
 void *ishmemi_copy(void *, const void *, size_t);
 void *ishmemi_zero(void *, size_t);
+/* Starts a copy on the copy engine, tracked by the given slot, then returns without waiting */
+int ishmemi_copy_async(void *dest, const void *src, size_t size, int slot);
+/* Waits for the copy tracked by the slot, if any */
+int ishmemi_copy_async_wait(int slot);
+/* The copy slots are shared by the process, so a caller holds this from its first copy until it
+ * has waited on all of them */
+extern std::mutex ishmemi_copy_async_mtx;
 void *ishmemi_ptr(const void *, int);
 void ishmemi_free(void *);
+void ishmemi_memory_report();
 
 #define ISHMEMI_FAST_ADJUST(TYPENAME, info, index, p)                                              \
     ((TYPENAME *) (reinterpret_cast<ptrdiff_t>(p) +                                                \
@@ -57,6 +71,10 @@ void ishmemi_free(void *);
     ((((uintptr_t) p) >= ((uintptr_t) ishmemi_heap_base)) &&                                       \
      (((uintptr_t) p) < (((uintptr_t) ishmemi_heap_base) + ishmemi_heap_length)))
 
+/* Host-readable address of p, which may be in the device heap */
+#define ISHMEMI_HOST_READABLE_ADDR(TYPENAME, p)                                                    \
+    (ISHMEMI_HOST_IN_HEAP(p) ? ISHMEMI_DEVICE_TO_MMAP_ADDR(TYPENAME, p) : (TYPENAME *) (p))
+
 /* Common code for pointer arithmetic */
 template <typename T>
 inline T *pointer_offset(T *p, ptrdiff_t offset)
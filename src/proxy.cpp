@@ -84,6 +84,10 @@ void ishmemi_cpu_ring::poll(size_t mwait_burst)
             }
             next_receive = next_receive + 1;
             _movdir64b((void *) &ishmemi_ring_host_completions[completion_index], &comp);
+            /* A request with an allocated completion is waited on there rather than in the ring */
+            if (msg.completion >= RING_SIZE) {
+                _movdir64b((void *) &ishmemi_ring_host_completions[msg.completion], &comp);
+            }
         } else {
             atomic_lock.store(0);  // release lock
             ishmemi_runtime->progress();
@@ -99,6 +103,7 @@ void ishmemi_cpu_ring::poll(size_t mwait_burst)
 void host_proxy_thread(void *arg)
 {
     size_t mwait_burst = ishmemi_params.MWAIT_BURST;
+    ishmemi_runtime->proxy_thread_init();
     while (ishmemi_cpu_info->proxy_state != EXIT) {
         ishmemi_cpu_info->ring.poll(mwait_burst);
     }
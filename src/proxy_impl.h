@@ -104,6 +104,15 @@ class ishmemi_completion {
             ;
     }
 
+    bool test(unsigned int index, uint16_t sequence)
+    {
+        ishmemi_ringcompletion_t *comp = &completions[index];
+        sycl::atomic_ref<unsigned int, sycl::memory_order::acq_rel, sycl::memory_scope::system,
+                         sycl::access::address_space::global_space>
+            atomic_comp_sequence(comp->completion.sequence);
+        return (atomic_comp_sequence & 0x1ffff) == (uint32_t) sequence;
+    }
+
     void free(unsigned int index)
     {
         ishmemi_ringcompletion_t *comp = &completions[index];
@@ -275,7 +284,15 @@ typedef struct ishmemi_cpu_info_t {
 
     /* Other variables */
     size_t n_teams;
-    ishmemi_team_host_t *team_host_pool;
+    ishmemi_team_pool_t<ishmemi_team_host_t> team_host_pool;
+    ishmemi_team_sync_algorithm_t team_sync_algorithm;
+    size_t reduce_rsag_cutover;
+    size_t bcast_pipeline_cutover;
+    size_t bcast_pipeline_chunk;
+    ishmemi_alltoall_schedule_t alltoall_schedule;
+    ishmemi_cutover_t cutover;
+    bool hierarchical;
+    ishmem_team_t leader_team;
     ishmemx_attr_t *attr;
 } ishmemi_cpu_info_t;
 
@@ -294,7 +311,15 @@ typedef struct ishmemi_info_t {
     int n_pes;
     /* Teams variables */
     size_t n_teams;
-    ishmemi_team_device_t *team_device_pool;
+    ishmemi_team_pool_t<ishmemi_team_device_t> team_device_pool;
+    ishmemi_team_sync_algorithm_t team_sync_algorithm;
+    size_t reduce_rsag_cutover;    /* Link bytes saved per PE above which reductions scatter */
+    size_t bcast_pipeline_cutover; /* Bytes above which intra-node broadcasts are pipelined */
+    size_t bcast_pipeline_chunk;   /* Bytes per chunk of a pipelined broadcast */
+    ishmemi_alltoall_schedule_t alltoall_schedule;
+    ishmemi_cutover_t cutover;     /* Bytes at or above which device operations use the proxy */
+    bool hierarchical;             /* Use hierarchical collectives on ISHMEM_TEAM_WORLD */
+    ishmem_team_t leader_team;     /* One PE per node, valid on node leaders when hierarchical */
 
     /* IPC variables */
     void *heap_base;
@@ -380,9 +405,21 @@ ISHMEM_DEVICE_ATTRIBUTES inline T ishmemi_proxy_blocking_request_return(ishmemi_
 ISHMEM_DEVICE_ATTRIBUTES inline void ishmemi_proxy_nonblocking_request(ishmemi_request_t &req)
 {
     ishmemi_info_t *info = global_info;
+    req.completion = 0;
     info->ring.send(req);
 }
 
+/* Sends the request with an allocated completion, which stays locked until the caller frees it
+ * after ishmemi_completion::wait.  Returns the allocated index in the upper 16 bits and the
+ * request sequence in the lower 16 bits */
+ISHMEM_DEVICE_ATTRIBUTES inline uint32_t ishmemi_proxy_allocated_request(ishmemi_request_t &req)
+{
+    ishmemi_info_t *info = global_info;
+    req.completion = info->completion.allocate();
+    uint32_t sequence = info->ring.send(req);
+    return (static_cast<uint32_t>(req.completion) << 16) | (sequence & 0xffff);
+}
+
 #define ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP)                                                      \
     /* Basic arguments */                                                                          \
     T *dest __attribute__((unused)) = static_cast<T *>(msg->dst);                                  \
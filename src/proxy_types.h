@@ -26,7 +26,11 @@ typedef struct {
         size_t *indices;
     };
     void *dst;
-    size_t nelems;
+    union {
+        size_t nelems;
+        /* Per-PE element counts for alltoallv */
+        const size_t *src_nelems;
+    };
     union {
         /* Signal address for put-signal */
         uint64_t *sig_addr;
@@ -47,6 +51,8 @@ typedef struct {
         int sig_op;
         /* Destination stride value for iput/iget*/
         ptrdiff_t dst_stride;
+        /* Per-PE destination offsets for alltoallv */
+        const size_t *dest_offsets;
     };
     /* Attribute used for values needed for comparison, signal  */
     union {
@@ -56,6 +62,8 @@ typedef struct {
         uint64_t signal;
         /* Source stride value for iput/iget*/
         ptrdiff_t src_stride;
+        /* Per-PE source offsets for alltoallv */
+        const size_t *src_offsets;
     };
     /* Operation and data type. */
     ishmemi_op_t op;
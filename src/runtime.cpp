@@ -24,6 +24,13 @@ int ishmemi_runtime_type::unsupported(ishmemi_request_t *msg, ishmemi_ringcomple
     return -1;
 }
 
+int ishmemi_runtime_type::request_test(void *request, bool *done)
+{
+    ISHMEM_ERROR_MSG("Runtime backend does not support nonblocking collectives\n");
+    *done = true;
+    return -1;
+}
+
 const char *ishmemi_runtime_type::team_predefined_string(ishmemi_runtime_team_predefined_t val)
 {
     switch (val) {
@@ -9,6 +9,7 @@
 #include "proxy_impl.h"
 
 typedef int (*ishmemi_runtime_proxy_func_t)(ishmemi_request_t *, ishmemi_ringcompletion_t *);
+typedef int (*ishmemi_runtime_nb_func_t)(ishmemi_request_t *, void **);
 
 typedef enum {
     WORLD,
@@ -42,6 +43,8 @@ class ishmemi_runtime_type {
     virtual void *malloc(size_t) = 0;
     virtual void *calloc(size_t, size_t) = 0;
     virtual void free(void *) = 0;
+    /* Whether malloc returns symmetric memory, whose allocation is collective over all PEs */
+    virtual bool malloc_is_symmetric(void) = 0;
 
     /* Team APIs */
     const char *team_predefined_string(ishmemi_runtime_team_predefined_t);
@@ -51,6 +54,11 @@ class ishmemi_runtime_type {
     virtual int team_split_strided(ishmemi_runtime_team_t, int, int, int,
                                    const ishmemi_runtime_team_config_t *, long,
                                    ishmemi_runtime_team_t *) = 0;
+    /* Lazy teams are created locally from their world <start, stride, size>, team PE, and a tag
+     * that all members pass alike and that no other live lazy team uses.  The backend builds its
+     * communicator on first use, collectively over the team members only */
+    virtual bool team_lazy_supported(void) = 0;
+    virtual int team_create_lazy(int, int, int, int, int, ishmemi_runtime_team_t *) = 0;
     virtual void team_destroy(ishmemi_runtime_team_t) = 0;
 
     /* Operation APIs */
@@ -71,11 +79,22 @@ class ishmemi_runtime_type {
 
     virtual void progress(void) = 0;
 
+    /* Called on the proxy thread before it starts servicing requests */
+    virtual void proxy_thread_init(void) {}
+
     static int unsupported(ishmemi_request_t *, ishmemi_ringcompletion_t *);
 
+    /* Nonblocking collective APIs.  A function in nb_funcs starts the collective in the request
+     * and returns an opaque runtime request, which request_test polls and frees once complete */
+    virtual int request_test(void *, bool *);
+
     /* Function table */
     ishmemi_runtime_proxy_func_t **proxy_funcs = nullptr;
 
+    /* Nonblocking collective function table, left null by backends without them.  A null entry
+     * means the backend has no nonblocking variant of that collective */
+    ishmemi_runtime_nb_func_t **nb_funcs = nullptr;
+
     /* This sums the total number of base types used in defining the proxy function pointers:
      * - void, uint8_t, uint16_t, uint32_t, uint64_t, unsigned long long, int8_t, int16_t, int32_t,
      *   int64_t, long long, float, double, long double
@@ -8,8 +8,13 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <algorithm>
+#include <chrono>
+#include <immintrin.h>
 #include <mpi.h>
 
+#include "ishmem/env_utils.h"
 #include "accelerator.h"
 #include "runtime.h"
 #include "runtime_mpi.h"
@@ -43,7 +48,7 @@
     int size __attribute__((unused)) =                                                             \
         ishmemi_runtime_mpi::teams[ishmemi_runtime_mpi::world_team].size;                          \
     if constexpr (ishmemi_op_uses_team<OP>()) {                                                    \
-        comm = ishmemi_runtime_mpi::teams[TEAM_PTR->runtime_team.mpi].comm;                        \
+        comm = ishmemi_runtime_mpi::team_comm(TEAM_PTR->runtime_team.mpi);                         \
         rank = ishmemi_runtime_mpi::teams[TEAM_PTR->runtime_team.mpi].rank;                        \
         size = ishmemi_runtime_mpi::teams[TEAM_PTR->runtime_team.mpi].size;                        \
     }
@@ -63,6 +68,8 @@
 
 #define CALC_DISP(target, base) (intptr_t) target - (ptrdiff_t) base
 
+#define ISHMEMI_MPI_DATATYPE_CACHE_MIN 2 /* The strided types a single operation holds */
+
 #define CONVERT_GPU_BUFFER(QUALIFIER, TYPE, var, size, constexpr_check)                            \
     QUALIFIER TYPE *var##_host = var;                                                              \
     bool var##_gpu = false;                                                                        \
@@ -123,6 +130,266 @@ namespace {
         return true;
     }
 
+    /* Drops the completed requests at the head of the RMA request ring.  Called with rma_mtx
+     * held */
+    inline void rma_ring_advance_locked()
+    {
+        std::vector<MPI_Request> &requests = ishmemi_runtime_mpi::rma_requests;
+        size_t &head = ishmemi_runtime_mpi::rma_head;
+        std::atomic<size_t> &count = ishmemi_runtime_mpi::rma_count;
+
+        while (count > 0 && requests[head] == MPI_REQUEST_NULL) {
+            head = (head + 1) % requests.size();
+            --count;
+        }
+    }
+
+    /* Runs fn(first, n) over each contiguous run of outstanding requests in the ring.  Called with
+     * rma_mtx held */
+    template <typename F>
+    inline int rma_ring_for_each_run(F fn)
+    {
+        int ret = 0;
+        size_t head = ishmemi_runtime_mpi::rma_head;
+        size_t count = ishmemi_runtime_mpi::rma_count;
+        size_t first_run = std::min(count, ishmemi_runtime_mpi::rma_requests.size() - head);
+
+        if (first_run > 0) ret = fn(head, (int) first_run);
+        if (ret == 0 && count > first_run) ret = fn(0, (int) (count - first_run));
+        return ret;
+    }
+
+    /* Retires every completed request in the ring.  Called with rma_mtx held */
+    inline int rma_ring_test_locked()
+    {
+        int ret = rma_ring_for_each_run([](size_t first, int n) {
+            int ret = 0;
+            int completed = 0;
+            MPI_CHECK(ishmemi_mpi_wrappers::Testsome(n, &ishmemi_runtime_mpi::rma_requests[first],
+                                                     &completed,
+                                                     ishmemi_runtime_mpi::rma_indices.data(),
+                                                     MPI_STATUSES_IGNORE));
+            if (completed != MPI_UNDEFINED) {
+                ishmemi_runtime_mpi::progress_completions += (uint64_t) completed;
+            }
+            return ret;
+        });
+        rma_ring_advance_locked();
+        return ret;
+    }
+
+    inline int rma_ring_test()
+    {
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_mpi::rma_mtx);
+        if (ishmemi_runtime_mpi::rma_count == 0) return 0;
+        return rma_ring_test_locked();
+    }
+
+    /* Waits for every request in the ring to complete */
+    inline int rma_ring_wait()
+    {
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_mpi::rma_mtx);
+        int ret = rma_ring_for_each_run([](size_t first, int n) {
+            int ret = 0;
+            MPI_CHECK(ishmemi_mpi_wrappers::Waitall(n, &ishmemi_runtime_mpi::rma_requests[first],
+                                                    MPI_STATUSES_IGNORE));
+            return ret;
+        });
+        rma_ring_advance_locked();
+        return ret;
+    }
+
+    /* Issues a nonblocking RMA operation into the next slot of the ring, first retiring completed
+     * requests, or waiting for the oldest, if the ring is full.  issue(req, origin) starts the
+     * operation with *req as its request and may stage an atomic operand in *origin */
+    template <typename F>
+    inline int rma_ring_issue(F issue)
+    {
+        int ret = 0;
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_mpi::rma_mtx);
+        std::vector<MPI_Request> &requests = ishmemi_runtime_mpi::rma_requests;
+        size_t capacity = requests.size();
+        size_t slot = 0;
+
+        if (ishmemi_runtime_mpi::rma_count == capacity) {
+            ret = rma_ring_test_locked();
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+        }
+        if (ishmemi_runtime_mpi::rma_count == capacity) {
+            MPI_Request *oldest = &requests[ishmemi_runtime_mpi::rma_head];
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Wait(oldest, MPI_STATUS_IGNORE));
+            rma_ring_advance_locked();
+        }
+
+        slot = (ishmemi_runtime_mpi::rma_head + ishmemi_runtime_mpi::rma_count) % capacity;
+        MPI_CHECK_GOTO(fn_exit, issue(&requests[slot], &ishmemi_runtime_mpi::rma_origins[slot]));
+        ++ishmemi_runtime_mpi::rma_count;
+
+    fn_exit:
+        return ret;
+    }
+
+    /* Records that RMA to pe is outstanding until the next fence, quiet, or barrier */
+    inline void mark_dirty(int pe)
+    {
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_mpi::dirty_mtx);
+        if (ishmemi_runtime_mpi::dirty_all || ishmemi_runtime_mpi::dirty_map[pe]) return;
+        if (ishmemi_runtime_mpi::dirty_targets.size() == ishmemi_runtime_mpi::dirty_targets_max) {
+            ishmemi_runtime_mpi::dirty_all = true;
+            return;
+        }
+        ishmemi_runtime_mpi::dirty_map[pe] = 1;
+        ishmemi_runtime_mpi::dirty_targets.push_back(pe);
+    }
+
+    /* Completes the RMA to every target recorded by mark_dirty since the last call, and retires
+     * every request in the ring */
+    inline int flush_dirty(MPI_Win win)
+    {
+        int ret = 0;
+        int targets[ishmemi_runtime_mpi::dirty_targets_max];
+        size_t ntargets = 0;
+        bool all = false;
+
+        {
+            const std::lock_guard<std::mutex> lock(ishmemi_runtime_mpi::dirty_mtx);
+            all = ishmemi_runtime_mpi::dirty_all;
+            for (int pe : ishmemi_runtime_mpi::dirty_targets) {
+                ishmemi_runtime_mpi::dirty_map[pe] = 0;
+                targets[ntargets++] = pe;
+            }
+            ishmemi_runtime_mpi::dirty_targets.clear();
+            ishmemi_runtime_mpi::dirty_all = false;
+        }
+
+        if (all) {
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_all(win));
+        } else {
+            for (size_t i = 0; i < ntargets; ++i) {
+                MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush(targets[i], win));
+            }
+        }
+
+        ret = rma_ring_wait();
+
+    fn_exit:
+        return ret;
+    }
+
+    /* Some MPI routines may skip internal progress. This can be used to manually poll MPI progress
+     * in those cases. */
+    inline void force_progress(MPI_Comm comm)
+    {
+        int ret __attribute__((unused)) = 0;
+        int iprobe_flag = 0;
+
+        MPI_CHECK(ishmemi_mpi_wrappers::Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &iprobe_flag,
+                                               MPI_STATUS_IGNORE));
+    }
+
+    inline int64_t progress_now_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /* Makes MPI progress and retires completed RMA requests.  While no request or nonblocking
+     * collective is outstanding, this runs at most once per PROGRESS_INTERVAL unless force is set,
+     * since there is nothing for it to complete but incoming passive-target RMA */
+    inline void progress_impl(bool force)
+    {
+        int64_t now = progress_now_ns();
+        bool pending = (ishmemi_runtime_mpi::rma_count > 0) ||
+                       (ishmemi_runtime_mpi::pending_colls > 0);
+        int64_t interval = (int64_t) ishmemi_params.PROGRESS_INTERVAL * 1000;
+
+        if (!force && !pending &&
+            now - ishmemi_runtime_mpi::last_progress_ns.load(std::memory_order_relaxed) < interval)
+            return;
+        ishmemi_runtime_mpi::last_progress_ns.store(now, std::memory_order_relaxed);
+        ++ishmemi_runtime_mpi::progress_calls;
+
+        if (pending) rma_ring_test();
+        force_progress(ishmemi_runtime_mpi::teams[ishmemi_runtime_mpi::world_team].comm);
+    }
+
+    /* Body of the helper thread started by PROGRESS_THREAD, which takes over progress from the
+     * proxy thread.  It sleeps for PROGRESS_INTERVAL while nothing is outstanding */
+    void progress_thread_fn()
+    {
+        while (ishmemi_runtime_mpi::progress_thread_run.load(std::memory_order_acquire)) {
+            progress_impl(true);
+            if (ishmemi_runtime_mpi::rma_count > 0 || ishmemi_runtime_mpi::pending_colls > 0) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(
+                    std::chrono::microseconds(ishmemi_params.PROGRESS_INTERVAL));
+            }
+        }
+    }
+
+    /* Returns the index in shm_comms of comm, or -1 if comm has no shared-memory barrier */
+    inline int shm_team_index(MPI_Comm comm)
+    {
+        if (ishmemi_runtime_mpi::shm_win == MPI_WIN_NULL || comm == MPI_COMM_NULL) return -1;
+        for (int i = 0; i < ishmemi_runtime_mpi::shm_nteams; i++) {
+            if (ishmemi_runtime_mpi::shm_comms[i] == comm) return i;
+        }
+        return -1;
+    }
+
+    inline uint64_t *shm_counter(int node_rank, int idx)
+    {
+        return reinterpret_cast<uint64_t *>(
+                   ishmemi_runtime_mpi::shm_peers[static_cast<size_t>(node_rank)]) +
+               idx;
+    }
+
+    inline uint8_t *shm_slot(int node_rank)
+    {
+        return ishmemi_runtime_mpi::shm_peers[static_cast<size_t>(node_rank)] +
+               ishmemi_runtime_mpi::shm_header_size;
+    }
+
+    /* Barrier among the node PEs through counters in the shared window.  Each PE publishes how
+     * many of these barriers it has entered and waits for every peer to reach the same count,
+     * making MPI progress meanwhile for peers whose RMA still depends on this PE.  The proxy and
+     * host threads may both enter it, so the published count only ever grows */
+    inline void shm_barrier(int idx)
+    {
+        int my_rank = ishmemi_runtime_mpi::teams[ishmemi_runtime_mpi::node_team].rank;
+        int npeers = static_cast<int>(ishmemi_runtime_mpi::shm_peers.size());
+        uint64_t epoch = ++ishmemi_runtime_mpi::shm_epochs[idx];
+        uint64_t *my_counter = shm_counter(my_rank, idx);
+
+        uint64_t published = __atomic_load_n(my_counter, __ATOMIC_RELAXED);
+        while (published < epoch &&
+               !__atomic_compare_exchange_n(my_counter, &published, epoch, true, __ATOMIC_RELEASE,
+                                            __ATOMIC_RELAXED)) {
+        }
+        for (int peer = 0; peer < npeers; peer++) {
+            while (__atomic_load_n(shm_counter(peer, idx), __ATOMIC_ACQUIRE) < epoch) {
+                progress_impl(false);
+                _mm_pause();
+            }
+        }
+    }
+
+    /* Synchronizes with the other PEs in comm, through shared memory when comm spans the node */
+    inline int barrier_comm(MPI_Comm comm)
+    {
+        int ret = 0;
+        int idx = shm_team_index(comm);
+
+        if (idx >= 0) {
+            shm_barrier(idx);
+        } else {
+            MPI_CHECK(ishmemi_mpi_wrappers::Barrier(comm));
+        }
+        return ret;
+    }
+
     inline int barrier_impl(MPI_Comm comm, MPI_Win win)
     {
         int ret = 0;
@@ -131,27 +398,35 @@ namespace {
         ishmemi_level_zero_sync();
 
         /* Ensure all local RMA facilitated by MPI backend are finished */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_all(win));
+        ret = flush_dirty(win);
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
         /* Syncronize the private and public windows */
         MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_sync(win));
 
         /* Synchronize with other PEs */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Barrier(comm));
+        ret = barrier_comm(comm);
 
     fn_exit:
         return ret;
     }
 
+    /* Orders the RMA issued so far before any issued later.  The window is created with
+     * accumulate_ordering set to none, so ordering still requires completing the RMA at each
+     * target; unlike quiet, fence leaves the private and public windows unsynchronized */
     inline int fence_impl(MPI_Win win)
     {
-        int ret = 0;
-
         /* Ensure L0 operations are finished */
         ishmemi_level_zero_sync();
 
-        /* Ensure all local RMA facilitated by MPI backend are finished */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_all(win));
+        /* Ensure all RMA facilitated by MPI backend is complete at its targets */
+        return flush_dirty(win);
+    }
+
+    inline int quiet_impl(MPI_Win win)
+    {
+        int ret = fence_impl(win);
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
         /* Syncronize the private and public windows */
         MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_sync(win));
@@ -160,11 +435,6 @@ namespace {
         return ret;
     }
 
-    inline int quiet_impl(MPI_Win win)
-    {
-        return fence_impl(win);
-    }
-
     inline int sync_impl(MPI_Comm comm, MPI_Win win)
     {
         int ret = 0;
@@ -173,97 +443,90 @@ namespace {
         MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_sync(win));
 
         /* Synchronize with other PEs */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Barrier(comm));
+        ret = barrier_comm(comm);
 
     fn_exit:
         return ret;
     }
 
+    /* Reads nelems contiguous ivars starting at start with a single atomic Get_accumulate, rather
+     * than with one Fetch_and_op per ivar */
     template <typename T>
-    inline int test_multi_impl(T cmp_value, int cmp, MPI_Datatype dt, int rank, MPI_Aint start,
-                               size_t nelems, const int *status, size_t *indices, size_t &complete,
-                               MPI_Win win)
+    inline int fetch_multi_impl(T *results, MPI_Datatype dt, int rank, MPI_Aint start,
+                                size_t nelems, MPI_Win win)
     {
         int ret = 0;
-        MPI_Op op = MPI_NO_OP;
         MPI_Aint disp = start;
-        T *results = (T *) ::calloc(nelems, sizeof(T));
-        ISHMEM_CHECK_GOTO_MSG(results == nullptr, fn_fail, "Unable to allocate host memory\n");
+        size_t offset = 0;
 
-        for (size_t i = 0; i < nelems; ++i) {
-            if (status && status[i]) {
-                disp = disp + (MPI_Aint) sizeof(T);
-                continue;
-            }
+        while (offset < nelems) {
+            size_t remaining = nelems - offset;
+            int count = (remaining > INT_MAX) ? INT_MAX : (int) remaining;
 
-            MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Fetch_and_op(nullptr, &results[i], dt,
-                                                                       rank, disp, op, win));
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Get_accumulate(
+                                        nullptr, 0, dt, &results[offset], count, dt, rank, disp,
+                                        count, dt, MPI_NO_OP, win));
 
-            disp = disp + (MPI_Aint) sizeof(T);
+            offset += (size_t) count;
+            disp = disp + (MPI_Aint) count * (MPI_Aint) sizeof(T);
         }
 
-        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Win_flush_local(rank, win));
-
-        for (size_t i = 0; i < nelems; ++i) {
-            int tmp;
-            if (status && status[i]) {
-                continue;
-            }
-
-            tmp = compare(cmp, results[i], cmp_value);
-            ISHMEM_CHECK_GOTO_MSG(tmp == -1, fn_fail, "Unknown or unsupported comparison op\n");
-            if (tmp == 1) {
-                indices[complete] = i;
-                ++complete;
-            }
-        }
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(rank, win));
 
     fn_exit:
-        ::free(results);
         return ret;
-    fn_fail:
-        ret = -1;
-        goto fn_exit;
     }
 
-    template <typename T>
-    inline int test_multi_impl(const T *cmp_values, int cmp, MPI_Datatype dt, int rank,
-                               MPI_Aint start, size_t nelems, const int *status, size_t *indices,
-                               size_t &complete, MPI_Win win)
-    {
-        int ret = 0;
-        MPI_Op op = MPI_NO_OP;
-        MPI_Aint disp = start;
-        T *results = (T *) ::calloc(nelems, sizeof(T));
-        ISHMEM_CHECK_GOTO_MSG(results == nullptr, fn_fail, "Unable to allocate host memory\n");
-
-        for (size_t i = 0; i < nelems; ++i) {
-            if (status && status[i]) {
-                disp = disp + (MPI_Aint) sizeof(T);
-                continue;
-            }
-
-            MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Fetch_and_op(nullptr, &results[i], dt,
-                                                                       rank, disp, op, win));
+#define COMPARE_MULTI_LOOP(CMP_OP)                                                                 \
+    for (size_t i = 0; i < nelems; ++i) {                                                          \
+        if constexpr (VECTOR) matches[i] = (results[i] CMP_OP cmp_values[i]) ? 1 : 0;              \
+        else matches[i] = (results[i] CMP_OP cmp_value) ? 1 : 0;                                   \
+    }                                                                                              \
+    return 0;
 
-            disp = disp + (MPI_Aint) sizeof(T);
+    /* Sets matches[i] to whether results[i] satisfies the comparison.  The comparison is selected
+     * once, so each loop is a branch-free compare that the compiler can vectorize */
+    template <typename T, bool VECTOR>
+    inline int compare_multi(int cmp, const T *results, T cmp_value, const T *cmp_values,
+                             size_t nelems, uint8_t *matches)
+    {
+        switch (cmp) {
+            case ISHMEM_CMP_EQ:
+                COMPARE_MULTI_LOOP(==);
+            case ISHMEM_CMP_NE:
+                COMPARE_MULTI_LOOP(!=);
+            case ISHMEM_CMP_GT:
+                COMPARE_MULTI_LOOP(>);
+            case ISHMEM_CMP_GE:
+                COMPARE_MULTI_LOOP(>=);
+            case ISHMEM_CMP_LT:
+                COMPARE_MULTI_LOOP(<);
+            case ISHMEM_CMP_LE:
+                COMPARE_MULTI_LOOP(<=);
+            default:
+                return -1;
         }
+    }
 
-        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Win_flush_local(rank, win));
+#undef COMPARE_MULTI_LOOP
 
-        for (size_t i = 0; i < nelems; ++i) {
-            int tmp;
-            if (status && status[i]) {
-                continue;
-            }
+    /* Fetches the nelems ivars starting at start and sets matches[i] to whether ivar i satisfies
+     * the comparison.  Ivars excluded by status are fetched too, since one contiguous read is
+     * cheaper than splitting the range around them */
+    template <typename T, bool VECTOR>
+    inline int test_multi_impl(T cmp_value, const T *cmp_values, int cmp, MPI_Datatype dt,
+                               int rank, MPI_Aint start, size_t nelems, uint8_t *matches,
+                               MPI_Win win)
+    {
+        int ret = 0;
+        T *results = (T *) ::malloc(nelems * sizeof(T));
+        ISHMEM_CHECK_GOTO_MSG(results == nullptr, fn_fail, "Unable to allocate host memory\n");
 
-            tmp = compare(cmp, results[i], cmp_values[i]);
-            ISHMEM_CHECK_GOTO_MSG(tmp == -1, fn_fail, "Unknown or unsupported comparison op\n");
-            if (tmp == 1) {
-                indices[complete] = i;
-                ++complete;
-            }
-        }
+        ret = fetch_multi_impl(results, dt, rank, start, nelems, win);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "Failed to fetch ivars\n");
+
+        ret = compare_multi<T, VECTOR>(cmp, results, cmp_value, cmp_values, nelems, matches);
+        ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_fail, "Unknown or unsupported comparison op\n");
 
     fn_exit:
         ::free(results);
@@ -296,15 +559,49 @@ namespace {
         goto fn_exit;
     }
 
-    /* Some MPI routines may skip internal progress. This can be used to manually poll MPI progress
-     * in those cases. */
-    inline void force_progress(MPI_Comm comm)
+    /* Number of local polls of an ivar between calls to progress_impl */
+    constexpr size_t LOCAL_WAIT_PROGRESS_INTERVAL = 64;
+    /* Upper bound, in TSC cycles, on a single UMWAIT while polling an ivar */
+    constexpr uint64_t LOCAL_WAIT_UMWAIT_CYCLES = 2000;
+
+    /* Host address through which the calling PE can read its own ivar directly, or nullptr if the
+     * ivar is not in the symmetric heap */
+    template <typename T>
+    inline const T *local_wait_addr(const T *ivar)
     {
-        int ret __attribute__((unused)) = 0;
-        int iprobe_flag = 0;
+        if (!ISHMEMI_HOST_IN_HEAP(ivar)) return nullptr;
+        if (ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP) return ivar;
+        return ISHMEMI_DEVICE_TO_MMAP_ADDR(const T, ivar);
+    }
 
-        MPI_CHECK(ishmemi_mpi_wrappers::Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &iprobe_flag,
-                                               MPI_STATUS_IGNORE));
+    /* Waits until the calling PE's own ivar satisfies the comparison by polling it with atomic
+     * loads through its host address, instead of an MPI round trip per read.  MPI progress is
+     * still made every LOCAL_WAIT_PROGRESS_INTERVAL polls so that updates from PEs relying on the
+     * target's progress complete.  Returns the satisfying value in value */
+    template <typename T>
+    inline int local_wait_impl(const T *ivar, T cmp_value, int cmp, T *value)
+    {
+        bool mwait = (ishmemi_params.MWAIT_BURST != 0);
+        size_t polls = 0;
+
+        while (true) {
+            T result = __atomic_load_n(ivar, __ATOMIC_ACQUIRE);
+            int ret = compare(cmp, result, cmp_value);
+            if (ret == -1) return -1;
+            if (ret == 1) {
+                if (value) *value = result;
+                return 0;
+            }
+
+            if (++polls % LOCAL_WAIT_PROGRESS_INTERVAL == 0) {
+                progress_impl(false);
+            } else if (mwait) {
+                _umonitor((void *) ivar);
+                _umwait(1, _rdtsc() + LOCAL_WAIT_UMWAIT_CYCLES);
+            } else {
+                _mm_pause();
+            }
+        }
     }
 
     int translate_rank(int pe, ishmemi_runtime_mpi::team_t source_team,
@@ -439,8 +736,16 @@ namespace impl {
             nelems = nelems * bsize;
         }
 
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Put(src, (int) nelems, dt, pe, disp,
-                                                          (int) nelems, dt, win));
+        if constexpr (FLUSH) {
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Put(src, (int) nelems, dt, pe, disp,
+                                                              (int) nelems, dt, win));
+        } else {
+            ret = rma_ring_issue([&](MPI_Request *req, uint64_t *) {
+                return ishmemi_mpi_wrappers::Rput(src, (int) nelems, dt, pe, disp, (int) nelems,
+                                                  dt, win, req);
+            });
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+        }
         if constexpr (SIGNAL) {
             MPI_Aint sig_disp = CALC_DISP(sig_addr, ishmemi_runtime_mpi::global_win_base_addr);
             MPI_Datatype sig_dt = MPI_UINT64_T;
@@ -452,10 +757,22 @@ namespace impl {
                 op = MPI_SUM;
             }
 
-            /* Blocking AMO case */
-            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Accumulate(&signal, 1, sig_dt, pe,
-                                                                     sig_disp, 1, sig_dt, op, win));
+            if constexpr (FLUSH) {
+                /* Blocking AMO case */
+                MPI_CHECK_GOTO(fn_exit,
+                               ishmemi_mpi_wrappers::Accumulate(&signal, 1, sig_dt, pe, sig_disp, 1,
+                                                                sig_dt, op, win));
+            } else {
+                /* Non-blocking AMO case */
+                ret = rma_ring_issue([&](MPI_Request *req, uint64_t *origin) {
+                    *origin = signal;
+                    return ishmemi_mpi_wrappers::Raccumulate(origin, 1, sig_dt, pe, sig_disp, 1,
+                                                             sig_dt, op, win, req);
+                });
+                ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+            }
         }
+        mark_dirty(pe);
 
         if constexpr (FLUSH) {
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
@@ -470,6 +787,7 @@ namespace impl {
     {
         int ret = 0;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
+        ishmemi_runtime_mpi::datatype_entry_t *sentry = nullptr, *dentry = nullptr;
 
         if constexpr (OP == IPUT) {
             bsize = 1;
@@ -481,19 +799,25 @@ namespace impl {
             MPI_Datatype sdt = MPI_DATATYPE_NULL;
             MPI_Datatype ddt = MPI_DATATYPE_NULL;
 
-            ishmemi_runtime_mpi::get_strided_dt(nelems, sst, bsize, 0, dt, &sdt);
+            ret = ishmemi_runtime_mpi::get_strided_dt(nelems, sst, bsize, 0, dt, &sdt, &sentry);
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
             if (sst != dst) {
-                ishmemi_runtime_mpi::get_strided_dt(nelems, dst, bsize, 0, dt, &ddt);
+                ret = ishmemi_runtime_mpi::get_strided_dt(nelems, dst, bsize, 0, dt, &ddt, &dentry);
+                ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
             } else {
                 ddt = sdt;
             }
 
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Put(src, 1, sdt, pe, disp, 1, ddt, win));
+            mark_dirty(pe);
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
         }
 
     fn_exit:
+        /* The put is issued, so its datatypes may be evicted */
+        ishmemi_runtime_mpi::release_strided_dt(sentry);
+        ishmemi_runtime_mpi::release_strided_dt(dentry);
         return ret;
     }
 
@@ -520,6 +844,7 @@ namespace impl {
                 src_offset = pointer_offset<T>(src_offset, (unsigned long) sst * sizeof(T));
                 disp_offset += (MPI_Aint) ((unsigned long) dst * sizeof(T));
             }
+            mark_dirty(pe);
 
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
         }
@@ -544,10 +869,17 @@ namespace impl {
             nelems = nelems * bsize;
         }
 
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Get(dest, (int) nelems, dt, pe, disp,
-                                                          (int) nelems, dt, win));
         if constexpr (FLUSH) {
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Get(dest, (int) nelems, dt, pe, disp,
+                                                              (int) nelems, dt, win));
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
+        } else {
+            /* The request completes the get, so pe needs no flush */
+            ret = rma_ring_issue([&](MPI_Request *req, uint64_t *) {
+                return ishmemi_mpi_wrappers::Rget(dest, (int) nelems, dt, pe, disp, (int) nelems,
+                                                  dt, win, req);
+            });
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
         }
 
         if constexpr (OP == G) {
@@ -563,6 +895,7 @@ namespace impl {
     {
         int ret = 0;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, src);
+        ishmemi_runtime_mpi::datatype_entry_t *sentry = nullptr, *dentry = nullptr;
 
         if constexpr (OP == IGET) {
             bsize = 1;
@@ -574,19 +907,24 @@ namespace impl {
             MPI_Datatype sdt = MPI_DATATYPE_NULL;
             MPI_Datatype ddt = MPI_DATATYPE_NULL;
 
-            ishmemi_runtime_mpi::get_strided_dt(nelems, sst, bsize, 0, dt, &sdt);
+            ret = ishmemi_runtime_mpi::get_strided_dt(nelems, sst, bsize, 0, dt, &sdt, &sentry);
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
 
             if (sst != dst) {
-                ishmemi_runtime_mpi::get_strided_dt(nelems, dst, bsize, 0, dt, &ddt);
+                ret = ishmemi_runtime_mpi::get_strided_dt(nelems, dst, bsize, 0, dt, &ddt, &dentry);
+                ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
             } else {
                 ddt = sdt;
             }
 
-            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Get(dest, 1, sdt, pe, disp, 1, ddt, win));
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Get(dest, 1, ddt, pe, disp, 1, sdt, win));
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
         }
 
     fn_exit:
+        /* The get is issued, so its datatypes may be evicted */
+        ishmemi_runtime_mpi::release_strided_dt(sentry);
+        ishmemi_runtime_mpi::release_strided_dt(dentry);
         return ret;
     }
 
@@ -650,9 +988,15 @@ namespace impl {
             ishmemi_union_set_field_value<T, OP>(comp->completion.ret, result);
         } else {
             /* Non-blocking AMO case */
-            MPI_CHECK_GOTO(fn_exit,
-                           ishmemi_mpi_wrappers::Fetch_and_op(&val, fetch, dt, pe, disp, op, win));
+            static_assert(sizeof(T) <= sizeof(uint64_t), "AMO operand does not fit a ring slot");
+            ret = rma_ring_issue([&](MPI_Request *req, uint64_t *origin) {
+                ::memcpy(origin, &val, sizeof(T));
+                return ishmemi_mpi_wrappers::Rget_accumulate(origin, 1, dt, fetch, 1, dt, pe, disp,
+                                                             1, dt, op, win, req);
+            });
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
         }
+        mark_dirty(pe);
 
     fn_exit:
         return ret;
@@ -680,6 +1024,7 @@ namespace impl {
             MPI_CHECK_GOTO(fn_exit,
                            ishmemi_mpi_wrappers::Fetch_and_op(&val, fetch, dt, pe, disp, op, win));
         }
+        mark_dirty(pe);
 
     fn_exit:
         return ret;
@@ -700,10 +1045,14 @@ namespace impl {
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
             ishmemi_union_set_field_value<T, OP>(comp->completion.ret, result);
         } else {
-            /* Non-blocking AMO case */
+            /* Non-blocking AMO case.  MPI has no request-based compare-and-swap, so complete it
+             * locally before val and cond go out of scope; remote completion still waits for the
+             * next fence, quiet, or barrier */
             MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Compare_and_swap(&val, &cond, fetch, dt,
                                                                            pe, disp, win));
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(pe, win));
         }
+        mark_dirty(pe);
 
     fn_exit:
         return ret;
@@ -733,6 +1082,102 @@ namespace impl {
         return ret;
     }
 
+    template <typename T>
+    static int alltoalls(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(T, ALLTOALLS);
+
+        /* Strided datatypes are not supported on GPU buffers, so the blocks are packed on the host
+         * through the mapping of the symmetric heap */
+        size_t total_nelems = nelems * (size_t) size;
+        const T *src_host = ISHMEMI_HOST_READABLE_ADDR(const T, src);
+        T *dest_host = ISHMEMI_HOST_READABLE_ADDR(T, dest);
+        T *sbuf = nullptr;
+        T *rbuf = nullptr;
+
+        if (total_nelems != 0) {
+            sbuf = (T *) ::malloc(sizeof(T) * total_nelems);
+            ISHMEM_CHECK_GOTO_MSG(sbuf == nullptr, fn_fail, "Unable to allocate host memory\n");
+            rbuf = (T *) ::malloc(sizeof(T) * total_nelems);
+            ISHMEM_CHECK_GOTO_MSG(rbuf == nullptr, fn_fail, "Unable to allocate host memory\n");
+        }
+
+        for (size_t i = 0; i < total_nelems; ++i) {
+            sbuf[i] = src_host[i * (size_t) sst];
+        }
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Alltoall(sbuf, (int) nelems, dt, rbuf,
+                                                               (int) nelems, dt, comm));
+        for (size_t i = 0; i < total_nelems; ++i) {
+            dest_host[i * (size_t) dst] = rbuf[i];
+        }
+
+    fn_exit:
+        comp->completion.ret.i = ret;
+
+        ::free(rbuf);
+        ::free(sbuf);
+
+        return ret;
+    fn_fail:
+        ret = -1;
+        goto fn_exit;
+    }
+
+    template <typename T>
+    static int alltoallv(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(T, ALLTOALLV);
+
+        const size_t *dest_offsets = ISHMEMI_HOST_READABLE_ADDR(const size_t, msg->dest_offsets);
+        const size_t *src_offsets = ISHMEMI_HOST_READABLE_ADDR(const size_t, msg->src_offsets);
+        const size_t *src_nelems = ISHMEMI_HOST_READABLE_ADDR(const size_t, msg->src_nelems);
+        int *sendcounts = nullptr;
+        int *sdispls = nullptr;
+        int *recvcounts = nullptr;
+        int *rdispls = nullptr;
+        int overflow = 0;
+
+        sendcounts = (int *) ::malloc(sizeof(int) * 4 * (size_t) size);
+        ISHMEM_CHECK_GOTO_MSG(sendcounts == nullptr, fn_fail, "Unable to allocate host memory\n");
+        sdispls = sendcounts + size;
+        recvcounts = sdispls + size;
+        rdispls = recvcounts + size;
+
+        /* MPI takes int counts and displacements.  Every PE must agree to fail, or the PEs that
+         * fit would wait in the exchange for the ones that do not */
+        overflow = 0;
+        for (int i = 0; i < size; ++i) {
+            if (src_nelems[i] > INT_MAX || src_offsets[i] > INT_MAX || dest_offsets[i] > INT_MAX) {
+                overflow = 1;
+                break;
+            }
+            sendcounts[i] = (int) src_nelems[i];
+            sdispls[i] = (int) src_offsets[i];
+            rdispls[i] = (int) dest_offsets[i];
+        }
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Allreduce(MPI_IN_PLACE, &overflow, 1, MPI_INT,
+                                                                MPI_MAX, comm));
+        ISHMEM_CHECK_GOTO_MSG(overflow, fn_fail,
+                              "alltoallv counts and offsets must fit in an int for MPI\n");
+
+        /* Exchange the counts, so each PE knows how much it receives from every other PE */
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Alltoall(sendcounts, 1, MPI_INT, recvcounts,
+                                                               1, MPI_INT, comm));
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Alltoallv(src, sendcounts, sdispls, dt, dest,
+                                                                recvcounts, rdispls, dt, comm));
+    fn_exit:
+        comp->completion.ret.i = ret;
+
+        ::free(sendcounts);
+
+        return ret;
+    fn_fail:
+        ret = -1;
+        goto fn_exit;
+    }
+
     static int broadcast(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
     {
         int ret = 0;
@@ -811,6 +1256,82 @@ namespace impl {
         return ret;
     }
 
+    /* Nonblocking collectives - each start allocates the MPI request that request_test frees */
+    static int ialltoall(ishmemi_request_t *msg, void **request)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(uint8_t, ALLTOALL);
+
+        MPI_Request *req = (MPI_Request *) ::malloc(sizeof(MPI_Request));
+        ISHMEM_CHECK_GOTO_MSG(req == nullptr, fn_fail, "Unable to allocate host memory\n");
+        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Ialltoall(src, (int) nelems, dt, dest,
+                                                                (int) nelems, dt, comm, req));
+        ++ishmemi_runtime_mpi::pending_colls;
+        *request = req;
+        return ret;
+    fn_fail:
+        ::free(req);
+        return (ret != 0) ? ret : -1;
+    }
+
+    static int ibroadcast(ishmemi_request_t *msg, void **request)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(uint8_t, BCAST);
+
+        MPI_Request *req = (MPI_Request *) ::malloc(sizeof(MPI_Request));
+        ISHMEM_CHECK_GOTO_MSG(req == nullptr, fn_fail, "Unable to allocate host memory\n");
+        if (rank == root) {
+            ishmemi_copy(dest, src, nelems);
+        }
+        MPI_CHECK_GOTO(fn_fail,
+                       ishmemi_mpi_wrappers::Ibcast(dest, (int) nelems, dt, root, comm, req));
+        ++ishmemi_runtime_mpi::pending_colls;
+        *request = req;
+        return ret;
+    fn_fail:
+        ::free(req);
+        return (ret != 0) ? ret : -1;
+    }
+
+    static int ifcollect(ishmemi_request_t *msg, void **request)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(uint8_t, FCOLLECT);
+
+        MPI_Request *req = (MPI_Request *) ::malloc(sizeof(MPI_Request));
+        ISHMEM_CHECK_GOTO_MSG(req == nullptr, fn_fail, "Unable to allocate host memory\n");
+        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Iallgather(src, (int) nelems, dt, dest,
+                                                                 (int) nelems, dt, comm, req));
+        ++ishmemi_runtime_mpi::pending_colls;
+        *request = req;
+        return ret;
+    fn_fail:
+        ::free(req);
+        return (ret != 0) ? ret : -1;
+    }
+
+    template <typename T, ishmemi_op_t OP>
+    static int ireduce(ishmemi_request_t *msg, void **request)
+    {
+        int ret = 0;
+        ISHMEMI_RUNTIME_MPI_REQUEST_HELPER(T, OP);
+        MPI_Op op = get_reduction_op<OP>();
+        /* Unlike the blocking call, the in-place case is spelled out, as MPI forbids aliasing */
+        const void *sendbuf = (src == dest) ? MPI_IN_PLACE : (const void *) src;
+
+        MPI_Request *req = (MPI_Request *) ::malloc(sizeof(MPI_Request));
+        ISHMEM_CHECK_GOTO_MSG(req == nullptr, fn_fail, "Unable to allocate host memory\n");
+        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Iallreduce(sendbuf, dest, (int) nelems, dt,
+                                                                 op, comm, req));
+        ++ishmemi_runtime_mpi::pending_colls;
+        *request = req;
+        return ret;
+    fn_fail:
+        ::free(req);
+        return (ret != 0) ? ret : -1;
+    }
+
     /* SCAN */
     template <typename T>
     int inscan(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
@@ -854,38 +1375,38 @@ namespace impl {
     static int test_all(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
     {
         int ret = 0;
+        int result = 1;
+        uint8_t *matches = nullptr;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
 
-        if (nelems == 0) ret = 1;
-
         /* Get host buffers */
         CONVERT_GPU_BUFFER(const, int, status, sizeof(int) * nelems, true);
         CONVERT_GPU_BUFFER(const, T, cmp_values, sizeof(T) * nelems, VECTOR);
 
-        for (size_t i = 0; i < nelems; ++i) {
-            if (status_host && status_host[i]) {
-                disp = disp + (MPI_Aint) sizeof(T);
-                continue;
-            }
-
-            if constexpr (VECTOR) {
-                ret = test_impl(cmp_values_host[i], cmp, dt, rank, disp, win);
-            } else {
-                ret = test_impl(cmp_value, cmp, dt, rank, disp, win);
-            }
+        if (nelems != 0) {
+            matches = (uint8_t *) ::malloc(nelems);
+            ISHMEM_CHECK_GOTO_MSG(matches == nullptr, fn_exit, "Unable to allocate host memory\n");
 
+            ret = test_multi_impl<T, VECTOR>(cmp_value, cmp_values_host, cmp, dt, rank, disp,
+                                             nelems, matches, win);
             ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute test_all");
-            if (ret == 0) break;
-            disp = disp + (MPI_Aint) sizeof(T);
+
+            for (size_t i = 0; i < nelems; ++i) {
+                if (!matches[i] && !(status_host && status_host[i])) {
+                    result = 0;
+                    break;
+                }
+            }
         }
 
         CLEANUP_GPU_BUFFER(int, status, sizeof(int) * nelems, true);
         CLEANUP_GPU_BUFFER(T, cmp_values, sizeof(T) * nelems, VECTOR);
 
-        comp->completion.ret.i = ret;
+        comp->completion.ret.i = result;
         ret = 0;
 
     fn_exit:
+        ::free(matches);
         return ret;
     }
 
@@ -894,30 +1415,27 @@ namespace impl {
     {
         size_t complete = SIZE_MAX;
         int ret = 0;
+        uint8_t *matches = nullptr;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
 
         /* Get host buffers */
         CONVERT_GPU_BUFFER(const, int, status, sizeof(int) * nelems, true);
         CONVERT_GPU_BUFFER(const, T, cmp_values, sizeof(T) * nelems, VECTOR);
 
-        for (size_t i = 0; i < nelems; ++i) {
-            if (status_host && status_host[i]) {
-                disp = disp + (MPI_Aint) sizeof(T);
-                continue;
-            }
-
-            if constexpr (VECTOR) {
-                ret = test_impl(cmp_values_host[i], cmp, dt, rank, disp, win);
-            } else {
-                ret = test_impl(cmp_value, cmp, dt, rank, disp, win);
-            }
+        if (nelems != 0) {
+            matches = (uint8_t *) ::malloc(nelems);
+            ISHMEM_CHECK_GOTO_MSG(matches == nullptr, fn_exit, "Unable to allocate host memory\n");
 
+            ret = test_multi_impl<T, VECTOR>(cmp_value, cmp_values_host, cmp, dt, rank, disp,
+                                             nelems, matches, win);
             ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute test_any");
-            if (ret == 1) {
-                complete = i;
-                break;
+
+            for (size_t i = 0; i < nelems; ++i) {
+                if (matches[i] && !(status_host && status_host[i])) {
+                    complete = i;
+                    break;
+                }
             }
-            disp = disp + (MPI_Aint) sizeof(T);
         }
 
         CLEANUP_GPU_BUFFER(int, status, sizeof(int) * nelems, true);
@@ -927,6 +1445,7 @@ namespace impl {
         ret = 0;
 
     fn_exit:
+        ::free(matches);
         return ret;
     }
 
@@ -935,6 +1454,7 @@ namespace impl {
     {
         size_t complete = 0;
         int ret = 0;
+        uint8_t *matches = nullptr;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
 
         /* Get host buffers */
@@ -942,14 +1462,21 @@ namespace impl {
         CONVERT_GPU_BUFFER(const, int, status, sizeof(int) * nelems, true);
         CONVERT_GPU_BUFFER(const, T, cmp_values, sizeof(T) * nelems, VECTOR);
 
-        if constexpr (VECTOR) {
-            ret = test_multi_impl(cmp_values_host, cmp, dt, rank, disp, nelems, status_host,
-                                  indices_host, complete, win);
-        } else {
-            ret = test_multi_impl(cmp_value, cmp, dt, rank, disp, nelems, status_host, indices_host,
-                                  complete, win);
+        if (nelems != 0) {
+            matches = (uint8_t *) ::malloc(nelems);
+            ISHMEM_CHECK_GOTO_MSG(matches == nullptr, fn_exit, "Unable to allocate host memory\n");
+
+            ret = test_multi_impl<T, VECTOR>(cmp_value, cmp_values_host, cmp, dt, rank, disp,
+                                             nelems, matches, win);
+            ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to run multiple test ops\n");
+
+            for (size_t i = 0; i < nelems; ++i) {
+                if (matches[i] && !(status_host && status_host[i])) {
+                    indices_host[complete] = i;
+                    ++complete;
+                }
+            }
         }
-        ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to run multiple test ops\n");
 
         CLEANUP_GPU_BUFFER(size_t, indices, sizeof(size_t) * nelems, true);
         CLEANUP_GPU_BUFFER(int, status, sizeof(int) * nelems, true);
@@ -959,6 +1486,7 @@ namespace impl {
         ret = 0;
 
     fn_exit:
+        ::free(matches);
         return ret;
     }
 
@@ -968,18 +1496,24 @@ namespace impl {
         MPI_Op op = MPI_NO_OP;
         uint64_t result;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(uint64_t, SIGNAL_WAIT_UNTIL, sig_addr);
+        const uint64_t *local_sig = local_wait_addr(sig_addr);
 
-        while (true) {
-            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Fetch_and_op(nullptr, &result, dt, rank,
-                                                                       disp, op, win));
+        if (local_sig != nullptr) {
+            ret = local_wait_impl(local_sig, cmp_value, cmp, &result);
+            ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Unknown or unsupported comparison op\n");
+        } else {
+            while (true) {
+                MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Fetch_and_op(nullptr, &result, dt,
+                                                                           rank, disp, op, win));
 
-            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(rank, win));
+                MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_flush_local(rank, win));
 
-            ret = compare(cmp, result, cmp_value);
-            ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Unknown or unsupported comparison op\n");
+                ret = compare(cmp, result, cmp_value);
+                ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Unknown or unsupported comparison op\n");
 
-            if (ret == 1) break;
-            force_progress(comm);
+                if (ret == 1) break;
+                progress_impl(false);
+            }
         }
 
         comp->completion.ret.ui64 = result;
@@ -995,12 +1529,18 @@ namespace impl {
     {
         int ret = 0;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
+        const T *local_dest = local_wait_addr(dest);
 
-        while (true) {
-            ret = test_impl(cmp_value, cmp, dt, rank, disp, win);
+        if (local_dest != nullptr) {
+            ret = local_wait_impl(local_dest, cmp_value, cmp, (T *) nullptr);
             ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute wait_until");
-            if (ret == 1) break;
-            force_progress(comm);
+        } else {
+            while (true) {
+                ret = test_impl(cmp_value, cmp, dt, rank, disp, win);
+                ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute wait_until");
+                if (ret == 1) break;
+                progress_impl(false);
+            }
         }
 
         ret = 0;
@@ -1014,6 +1554,7 @@ namespace impl {
     {
         int ret = 0;
         ISHMEMI_RUNTIME_MPI_DISP_REQUEST_HELPER(T, OP, dest);
+        const T *local_dest = local_wait_addr(dest);
 
         /* Get host buffers */
         CONVERT_GPU_BUFFER(const, int, status, sizeof(int) * nelems, true);
@@ -1033,6 +1574,14 @@ namespace impl {
                     disp = disp + (MPI_Aint) sizeof(T);
                     continue;
                 }
+                if (local_dest != nullptr) {
+                    T value = cmp_value;
+                    if constexpr (VECTOR) value = cmp_values_host[i];
+                    ret = local_wait_impl(&local_dest[i], value, cmp, (T *) nullptr);
+                    ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute wait_until_all");
+                    disp = disp + (MPI_Aint) sizeof(T);
+                    continue;
+                }
                 while (true) {
                     if constexpr (VECTOR) {
                         ret = test_impl(cmp_values_host[i], cmp, dt, rank, disp, win);
@@ -1042,7 +1591,7 @@ namespace impl {
 
                     ISHMEM_CHECK_GOTO_MSG(ret == -1, fn_exit, "Failed to execute wait_until_all");
                     if (ret == 1) break;
-                    force_progress(comm);
+                    progress_impl(false);
                 }
                 disp = disp + (MPI_Aint) sizeof(T);
             }
@@ -1097,7 +1646,7 @@ namespace impl {
                         break;
                     }
                     tmp_disp = tmp_disp + (MPI_Aint) sizeof(T);
-                    force_progress(comm);
+                    progress_impl(false);
                 }
 
                 /* Completion condition */
@@ -1158,7 +1707,7 @@ namespace impl {
                     }
 
                     tmp_disp = tmp_disp + (MPI_Aint) sizeof(T);
-                    force_progress(comm);
+                    progress_impl(false);
                 }
 
                 /* Completion condition */
@@ -1233,11 +1782,38 @@ ishmemi_runtime_mpi_types::team_t ishmemi_runtime_mpi::shared_team =
 ishmemi_runtime_mpi_types::team_t ishmemi_runtime_mpi::team_idx = 0;
 
 std::map<ishmemi_runtime_mpi_types::team_t, ishmemi_runtime_mpi::team_t> ishmemi_runtime_mpi::teams;
+std::mutex ishmemi_runtime_mpi::team_comm_mtx;
 
 MPI_Win ishmemi_runtime_mpi::global_win = MPI_WIN_NULL;
 void *ishmemi_runtime_mpi::global_win_base_addr = nullptr;
 size_t ishmemi_runtime_mpi::global_win_size = 0;
+MPI_Win ishmemi_runtime_mpi::shm_win = MPI_WIN_NULL;
+std::vector<uint8_t *> ishmemi_runtime_mpi::shm_peers;
+size_t ishmemi_runtime_mpi::shm_slot_size = 0;
+MPI_Comm ishmemi_runtime_mpi::shm_comms[ishmemi_runtime_mpi::shm_nteams] = {MPI_COMM_NULL,
+                                                                             MPI_COMM_NULL};
+std::atomic<uint64_t> ishmemi_runtime_mpi::shm_epochs[ishmemi_runtime_mpi::shm_nteams] = {0, 0};
+std::mutex ishmemi_runtime_mpi::datatype_mtx;
 ishmemi_runtime_mpi::datatype_entry_t *ishmemi_runtime_mpi::datatype_map = nullptr;
+uint64_t ishmemi_runtime_mpi::datatype_hits = 0;
+uint64_t ishmemi_runtime_mpi::datatype_misses = 0;
+uint64_t ishmemi_runtime_mpi::datatype_evictions = 0;
+std::mutex ishmemi_runtime_mpi::dirty_mtx;
+std::vector<int> ishmemi_runtime_mpi::dirty_targets;
+std::vector<uint8_t> ishmemi_runtime_mpi::dirty_map;
+bool ishmemi_runtime_mpi::dirty_all = false;
+std::mutex ishmemi_runtime_mpi::rma_mtx;
+std::vector<MPI_Request> ishmemi_runtime_mpi::rma_requests;
+std::vector<uint64_t> ishmemi_runtime_mpi::rma_origins;
+std::vector<int> ishmemi_runtime_mpi::rma_indices;
+size_t ishmemi_runtime_mpi::rma_head = 0;
+std::atomic<size_t> ishmemi_runtime_mpi::rma_count = 0;
+std::atomic<size_t> ishmemi_runtime_mpi::pending_colls = 0;
+std::atomic<uint64_t> ishmemi_runtime_mpi::progress_calls = 0;
+std::atomic<uint64_t> ishmemi_runtime_mpi::progress_completions = 0;
+std::atomic<int64_t> ishmemi_runtime_mpi::last_progress_ns = 0;
+std::atomic<bool> ishmemi_runtime_mpi::progress_thread_run = false;
+std::thread ishmemi_runtime_mpi::progress_thread;
 
 /* Class method implementations */
 ishmemi_runtime_mpi::ishmemi_runtime_mpi(bool initialize_runtime, void *mpi_comm)
@@ -1275,6 +1851,13 @@ ishmemi_runtime_mpi::ishmemi_runtime_mpi(bool initialize_runtime, void *mpi_comm
     world_team = team_idx++;
     teams[world_team] = std::move(temp_team);
 
+    dirty_targets.reserve(dirty_targets_max);
+    dirty_map.assign(static_cast<size_t>(teams[world_team].size), 0);
+
+    rma_requests.assign(std::max(ishmemi_params.NBI_COUNT, (size_t) 1), MPI_REQUEST_NULL);
+    rma_origins.assign(rma_requests.size(), 0);
+    rma_indices.assign(rma_requests.size(), 0);
+
     temp_team = {};
 
     if (teams[world_team].size > 1) {
@@ -1319,8 +1902,42 @@ ishmemi_runtime_mpi::ishmemi_runtime_mpi(bool initialize_runtime, void *mpi_comm
     teams[shared_team] = temp_team;
 
     /* Initialize the function pointer table */
+    gpu_non_contig_support = ishmemi_params.ENABLE_MPI_DATATYPES;
+    /* A strided put or get holds a source and a destination type at once, so a smaller cache
+     * would evict the first while the second is created */
+    if (ishmemi_params.MPI_DATATYPE_CACHE_SIZE == 1)
+        ishmemi_params.MPI_DATATYPE_CACHE_SIZE = ISHMEMI_MPI_DATATYPE_CACHE_MIN;
     this->funcptr_init();
 
+    /* Map the intra-node shared window, which host-side node barriers, syncs, and metadata
+     * exchanges use in place of MPI messaging */
+    if (ishmemi_params.MPI_SHARED_SLOT_SIZE > 0 && teams[node_team].size > 1) {
+        uint8_t *base = nullptr;
+        MPI_Aint seg_size = 0;
+        int disp_unit = 0;
+
+        shm_slot_size = (ishmemi_params.MPI_SHARED_SLOT_SIZE + shm_header_size - 1) /
+                        shm_header_size * shm_header_size;
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_allocate_shared(
+                                    (MPI_Aint) (shm_header_size + shm_slot_size), 1, MPI_INFO_NULL,
+                                    teams[node_team].comm, &base, &shm_win));
+        memset(base, 0, shm_header_size);
+
+        shm_peers.assign(static_cast<size_t>(teams[node_team].size), nullptr);
+        for (int i = 0; i < teams[node_team].size; i++) {
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_shared_query(
+                                        shm_win, i, &seg_size, &disp_unit, &shm_peers[i]));
+        }
+
+        /* Every counter must be zeroed before any PE enters a shared-memory barrier */
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Barrier(teams[node_team].comm));
+        /* The counters cover every node PE, so they only serve teams with all of them */
+        shm_comms[0] = teams[node_team].comm;
+        if (teams[shared_team].size == teams[node_team].size) {
+            shm_comms[1] = teams[shared_team].comm;
+        }
+    }
+
 fn_exit:
     return;
 }
@@ -1329,6 +1946,13 @@ ishmemi_runtime_mpi::~ishmemi_runtime_mpi(void)
 {
     int ret __attribute__((unused)) = 0;
 
+    /* Stop the progress helper thread first, as it progresses the world communicator and the
+     * windows released below */
+    if (progress_thread.joinable()) {
+        progress_thread_run.store(false, std::memory_order_release);
+        progress_thread.join();
+    }
+
     /* Cleanup the datatype map */
     if (datatype_map) {
         datatype_entry_t *entry = nullptr, *tmp = nullptr;
@@ -1339,6 +1963,13 @@ ishmemi_runtime_mpi::~ishmemi_runtime_mpi(void)
         }
     }
 
+    /* Release the intra-node shared window */
+    if (shm_win != MPI_WIN_NULL) {
+        shm_comms[0] = shm_comms[1] = MPI_COMM_NULL;
+        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_free(&shm_win));
+        shm_peers.clear();
+    }
+
     /* Cleanup the runtime-created teams */
     for (auto iter = teams.begin(); iter != teams.end();) {
         auto curr = iter++;
@@ -1347,6 +1978,18 @@ ishmemi_runtime_mpi::~ishmemi_runtime_mpi(void)
 
     world_team = shared_team = node_team = team_undefined;
 
+    if (ishmemi_params.PROGRESS_REPORT) {
+        fprintf(stderr, "[%04d] MPI PROGRESS: calls %lu completions %lu\n", ishmemi_my_pe,
+                (unsigned long) progress_calls.load(), (unsigned long) progress_completions.load());
+        fprintf(stderr, "[%04d] MPI DATATYPES: hits %lu misses %lu evictions %lu\n",
+                ishmemi_my_pe, (unsigned long) datatype_hits, (unsigned long) datatype_misses,
+                (unsigned long) datatype_evictions);
+    }
+
+    /* Retire any nonblocking RMA still in the request ring */
+    ret = rma_ring_wait();
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+
     /* Complete the access epoch */
     MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Win_unlock_all(global_win));
 
@@ -1393,6 +2036,12 @@ void ishmemi_runtime_mpi::heap_create(void *base, size_t size)
 
     MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Info_free(&info));
 
+    /* Hand progress to a helper thread once there is a window to progress */
+    if (ishmemi_params.PROGRESS_THREAD && !progress_thread.joinable()) {
+        progress_thread_run.store(true, std::memory_order_release);
+        progress_thread = std::thread(progress_thread_fn);
+    }
+
 fn_exit:
     return;
 }
@@ -1445,10 +2094,15 @@ void ishmemi_runtime_mpi::free(void *ptr)
     ::free(ptr);
 }
 
+bool ishmemi_runtime_mpi::malloc_is_symmetric(void)
+{
+    return false;
+}
+
 /* Team APIs */
 int ishmemi_runtime_mpi::team_sync(ishmemi_runtime_team_t team)
 {
-    return sync_impl(teams[team.mpi].comm, global_win);
+    return sync_impl(team_comm(team.mpi), global_win);
 }
 
 int ishmemi_runtime_mpi::team_predefined_set(ishmemi_runtime_team_t *team,
@@ -1468,6 +2122,7 @@ int ishmemi_runtime_mpi::team_predefined_set(ishmemi_runtime_team_t *team,
             /* This can happen when ISHMEM_ENABLE_GPU_IPC=0 */
             if (expected_team_size == 1 && teams[shared_team].size != 1) {
                 /* Cleanup the previous shared_team objects */
+                shm_comms[1] = MPI_COMM_NULL;
                 team_destroy_impl(shared_team);
 
                 /* Initialize a new shared_team with MPI_COMM_SELF */
@@ -1482,6 +2137,9 @@ int ishmemi_runtime_mpi::team_predefined_set(ishmemi_runtime_team_t *team,
                 teams[shared_team] = std::move(temp_team);
             }
 
+            /* The shared-memory barrier waits on every node PE, so it cannot serve a shared team
+             * smaller than the node */
+            if (teams[shared_team].size != teams[node_team].size) shm_comms[1] = MPI_COMM_NULL;
             team->mpi = shared_team;
             break;
         case NODE:
@@ -1548,6 +2206,58 @@ fn_exit:
     return ret;
 }
 
+bool ishmemi_runtime_mpi::team_lazy_supported(void)
+{
+    return true;
+}
+
+/* Only the group is built here, which is a local operation */
+int ishmemi_runtime_mpi::team_create_lazy(int start, int stride, int size, int team_pe, int tag,
+                                          ishmemi_runtime_team_t *new_team)
+{
+    int ret = 0;
+    team_t temp_team;
+    int ranges[1][3] = {{start, start + stride * (size - 1), stride}};
+
+    new_team->mpi = team_undefined;
+
+    MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Group_range_incl(teams[world_team].group, 1,
+                                                                   ranges, &temp_team.group));
+    temp_team.rank = team_pe;
+    temp_team.size = size;
+    temp_team.lazy = true;
+    temp_team.tag = tag;
+
+    new_team->mpi = team_idx++;
+    teams[new_team->mpi] = std::move(temp_team);
+
+fn_exit:
+    return ret;
+}
+
+/* Returns the communicator of a team, creating it first for a lazy team.  Creation is collective
+ * over the team members, which all reach it through the same operation on the team.  Members of
+ * several lazy teams may reach their first uses in different orders, so each team's creation
+ * carries its own tag */
+MPI_Comm ishmemi_runtime_mpi::team_comm(ishmemi_runtime_mpi_types::team_t idx)
+{
+    int ret = 0;
+    team_t &team = teams[idx];
+
+    if (team.lazy) {
+        const std::lock_guard<std::mutex> lock(team_comm_mtx);
+        if (team.comm == MPI_COMM_NULL) {
+            MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Comm_create_group(
+                                        teams[world_team].comm, team.group, team.tag, &team.comm));
+            ISHMEM_DEBUG_MSG("created communicator for lazy team %d\n", idx);
+        }
+    }
+
+fn_exit:
+    if (ret != 0) RAISE_ERROR_MSG("Creation of a lazy team communicator failed\n");
+    return team.comm;
+}
+
 void ishmemi_runtime_mpi::team_destroy(ishmemi_runtime_team_t team)
 {
     team_destroy_impl(team.mpi);
@@ -1572,7 +2282,7 @@ int ishmemi_runtime_mpi::uchar_and_reduce(ishmemi_runtime_team_t team, unsigned
     int ret = 0;
     MPI_Datatype dt = impl::get_datatype<unsigned char, AND_REDUCE>();
     MPI_Op op = impl::get_reduction_op<AND_REDUCE>();
-    MPI_Comm comm = teams[team.mpi].comm;
+    MPI_Comm comm = team_comm(team.mpi);
 
     MPI_CHECK(ishmemi_mpi_wrappers::Allreduce(source, dest, (int) nreduce, dt, op, comm));
     return ret;
@@ -1584,7 +2294,7 @@ int ishmemi_runtime_mpi::int_max_reduce(ishmemi_runtime_team_t team, int *dest,
     int ret = 0;
     MPI_Datatype dt = impl::get_datatype<int, MAX_REDUCE>();
     MPI_Op op = impl::get_reduction_op<MAX_REDUCE>();
-    MPI_Comm comm = teams[team.mpi].comm;
+    MPI_Comm comm = team_comm(team.mpi);
 
     MPI_CHECK(ishmemi_mpi_wrappers::Allreduce(source, dest, (int) nreduce, dt, op, comm));
     return ret;
@@ -1597,6 +2307,14 @@ void ishmemi_runtime_mpi::bcast(void *buf, size_t count, int root)
 
 void ishmemi_runtime_mpi::node_bcast(void *buf, size_t count, int root)
 {
+    /* Small broadcasts are staged through the root's slot of the shared window */
+    if (count <= shm_slot_size && shm_team_index(teams[node_team].comm) == 0) {
+        if (teams[node_team].rank == root) ::memcpy(shm_slot(root), buf, count);
+        shm_barrier(0);
+        if (teams[node_team].rank != root) ::memcpy(buf, shm_slot(root), count);
+        shm_barrier(0); /* the slot may be reused */
+        return;
+    }
     ishmemi_mpi_wrappers::Bcast(buf, (int) count, MPI_BYTE, root, teams[node_team].comm);
 }
 
@@ -1608,6 +2326,17 @@ void ishmemi_runtime_mpi::fcollect(void *dst, void *src, size_t count)
 
 void ishmemi_runtime_mpi::node_fcollect(void *dst, void *src, size_t count)
 {
+    /* Small exchanges are staged through each PE's slot of the shared window */
+    if (count <= shm_slot_size && shm_team_index(teams[node_team].comm) == 0) {
+        ::memcpy(shm_slot(teams[node_team].rank), src, count);
+        shm_barrier(0);
+        for (int peer = 0; peer < teams[node_team].size; peer++) {
+            ::memcpy(static_cast<uint8_t *>(dst) + static_cast<size_t>(peer) * count,
+                     shm_slot(peer), count);
+        }
+        shm_barrier(0); /* the slots may be reused */
+        return;
+    }
     ishmemi_mpi_wrappers::Allgather(src, (int) count, MPI_BYTE, dst, (int) count, MPI_BYTE,
                                     teams[node_team].comm);
 }
@@ -1640,57 +2369,128 @@ void ishmemi_runtime_mpi::sync(void)
 
 void ishmemi_runtime_mpi::progress(void)
 {
-    force_progress(teams[world_team].comm);
+    /* The helper thread, when enabled, owns progress */
+    if (progress_thread_run.load(std::memory_order_relaxed)) return;
+    progress_impl(false);
+}
+
+int ishmemi_runtime_mpi::request_test(void *request, bool *done)
+{
+    int ret = 0;
+    int flag = 0;
+    MPI_Request *req = static_cast<MPI_Request *>(request);
+
+    MPI_CHECK(ishmemi_mpi_wrappers::Test(req, &flag, MPI_STATUS_IGNORE));
+    *done = (flag != 0) || (ret != 0);
+    if (*done) {
+        --pending_colls;
+        if (flag != 0) ++progress_completions;
+        ::free(req);
+    }
+    return ret;
 }
 
 /* Private functions */
-void ishmemi_runtime_mpi::get_strided_dt(size_t nelems, ptrdiff_t stride, size_t block_size,
-                                         int extent, MPI_Datatype base, MPI_Datatype *datatype)
+/* Returns in datatype a committed vector of nelems blocks of block_size base elements, stride
+ * elements apart.  A positive extent, in base elements, resizes the vector so that consecutive
+ * instances of it start extent elements apart, as strided collectives need.  The cache entry of
+ * the datatype is returned in held, and cannot be evicted until it is passed to release_strided_dt
+ * once the operation using the datatype is issued */
+int ishmemi_runtime_mpi::get_strided_dt(size_t nelems, ptrdiff_t stride, size_t block_size,
+                                        int extent, MPI_Datatype base, MPI_Datatype *datatype,
+                                        datatype_entry_t **held)
 {
-    int ret __attribute__((unused)) = 0;
+    int ret = 0;
     MPI_Datatype tmp = MPI_DATATYPE_NULL;
-    datatype_key_t key = {(int) nelems, (int) stride, (int) block_size, extent, base};
+    MPI_Datatype dtype = MPI_DATATYPE_NULL;
+    MPI_Aint base_lb = 0, base_extent = 0;
+    datatype_key_t key;
     datatype_entry_t *entry = nullptr;
 
-    HASH_FIND(hh, datatype_map, &key.nelems, sizeof(datatype_key_t), entry);
+    /* Zeroed first, as the padding of the key is hashed too */
+    memset(&key, 0, sizeof(datatype_key_t));
+    key.nelems = (int) nelems;
+    key.stride = (int) stride;
+    key.block_size = (int) block_size;
+    key.extent = extent;
+    key.base = base;
+
+    const std::lock_guard<std::mutex> lock(datatype_mtx);
+    HASH_FIND(hh, datatype_map, &key, sizeof(datatype_key_t), entry);
 
     if (entry) {
+        /* Move the entry to the most recently used end of the cache */
+        HASH_DELETE(hh, datatype_map, entry);
+        HASH_ADD(hh, datatype_map, key, sizeof(datatype_key_t), entry);
+        ++datatype_hits;
+        ++entry->refs;
         *datatype = entry->datatype;
+        *held = entry;
+        goto fn_exit;
+    }
+    ++datatype_misses;
+
+    /* Create the vector type based on the provided base datatype */
+    MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Type_vector((int) nelems, (int) block_size,
+                                                              (int) stride, base, &tmp));
+
+    if (extent > 0) {
+        /* Extend the vector so that an operation can cover multiple elements of the strided type */
+        MPI_CHECK_GOTO(fn_fail,
+                       ishmemi_mpi_wrappers::Type_get_extent(base, &base_lb, &base_extent));
+        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Type_create_resized(
+                                    tmp, 0, (MPI_Aint) extent * base_extent, &dtype));
+        MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Type_free(&tmp));
     } else {
-        /* Create the vector type based on the provided base datatype */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Type_vector((int) nelems, (int) block_size,
-                                                                  (int) stride, base, &tmp));
-
-        if (extent > 0) {
-            /* If the extent is non-zero, we need to extend the vector type. This will occur when
-             * the operation needs to cover multiple elements of the strided type (i.e. strided
-             * collectives)
-             */
-            /* TODO */
-        } else {
-            *datatype = tmp;
-        }
+        dtype = tmp;
+        tmp = MPI_DATATYPE_NULL;
+    }
 
-        /* Commit the datatype */
-        MPI_CHECK_GOTO(fn_exit, ishmemi_mpi_wrappers::Type_commit(datatype));
+    /* Commit the datatype */
+    MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Type_commit(&dtype));
 
-        if (extent > 0) {
-            /* Cleanup the vector type if it needed to be extended */
-            /* TODO */
+    /* Evict the least recently used entries that no caller holds from a full cache.  MPI defers
+     * freeing a datatype until the operations already using it complete */
+    if (ishmemi_params.MPI_DATATYPE_CACHE_SIZE > 0) {
+        datatype_entry_t *oldest = nullptr, *next = nullptr;
+        HASH_ITER(hh, datatype_map, oldest, next)
+        {
+            if (HASH_COUNT(datatype_map) < ishmemi_params.MPI_DATATYPE_CACHE_SIZE) break;
+            if (oldest->refs > 0) continue;
+            HASH_DELETE(hh, datatype_map, oldest);
+            MPI_CHECK_GOTO(fn_fail, ishmemi_mpi_wrappers::Type_free(&oldest->datatype));
+            ::free(oldest);
+            ++datatype_evictions;
         }
+    }
 
-        /* Insert into the datatype cache */
-        entry = (datatype_entry_t *) ::malloc(sizeof(datatype_entry_t));
-        ISHMEM_CHECK_GOTO_MSG(entry == nullptr, fn_exit, "Allocation of datatype entry failed\n");
-        memset(entry, 0, sizeof(datatype_entry_t));
-        memcpy(&entry->key, &key, sizeof(datatype_key_t));
-        entry->datatype = *datatype;
+    /* Insert into the datatype cache */
+    entry = (datatype_entry_t *) ::malloc(sizeof(datatype_entry_t));
+    ISHMEM_CHECK_GOTO_MSG(entry == nullptr, fn_fail, "Allocation of datatype entry failed\n");
+    memset(entry, 0, sizeof(datatype_entry_t));
+    memcpy(&entry->key, &key, sizeof(datatype_key_t));
+    entry->datatype = dtype;
+    entry->refs = 1;
 
-        HASH_ADD(hh, datatype_map, key, sizeof(datatype_key_t), entry);
-    }
+    HASH_ADD(hh, datatype_map, key, sizeof(datatype_key_t), entry);
+    *datatype = dtype;
+    *held = entry;
 
 fn_exit:
-    return;
+    return ret;
+fn_fail:
+    if (tmp != MPI_DATATYPE_NULL) ishmemi_mpi_wrappers::Type_free(&tmp);
+    if (dtype != MPI_DATATYPE_NULL) ishmemi_mpi_wrappers::Type_free(&dtype);
+    if (ret == 0) ret = -1;
+    goto fn_exit;
+}
+
+/* Lets the cache evict an entry returned by get_strided_dt; a null entry is ignored */
+void ishmemi_runtime_mpi::release_strided_dt(datatype_entry_t *entry)
+{
+    if (entry == nullptr) return;
+    const std::lock_guard<std::mutex> lock(datatype_mtx);
+    --entry->refs;
 }
 
 void ishmemi_runtime_mpi::funcptr_init(void)
@@ -1955,6 +2755,14 @@ void ishmemi_runtime_mpi::funcptr_init(void)
     proxy_funcs[BARRIER][0] = impl::barrier;
     proxy_funcs[SYNC][0] = impl::sync<SYNC>;
     proxy_funcs[ALLTOALL][UINT8] = impl::alltoall;
+    proxy_funcs[ALLTOALLS][UINT8] = impl::alltoalls<uint8_t>;
+    proxy_funcs[ALLTOALLS][UINT16] = impl::alltoalls<uint16_t>;
+    proxy_funcs[ALLTOALLS][UINT32] = impl::alltoalls<uint32_t>;
+    proxy_funcs[ALLTOALLS][UINT64] = impl::alltoalls<uint64_t>;
+    proxy_funcs[ALLTOALLV][UINT8] = impl::alltoallv<uint8_t>;
+    proxy_funcs[ALLTOALLV][UINT16] = impl::alltoallv<uint16_t>;
+    proxy_funcs[ALLTOALLV][UINT32] = impl::alltoallv<uint32_t>;
+    proxy_funcs[ALLTOALLV][UINT64] = impl::alltoallv<uint64_t>;
     proxy_funcs[BCAST][UINT8] = impl::broadcast;
     proxy_funcs[COLLECT][UINT8] = impl::collect;
     proxy_funcs[FCOLLECT][UINT8] = impl::fcollect;
@@ -2176,6 +2984,106 @@ void ishmemi_runtime_mpi::funcptr_init(void)
     proxy_funcs[FENCE][0] = impl::fence;
     proxy_funcs[QUIET][0] = impl::quiet;
 
+    /* Nonblocking collectives */
+    nb_funcs = (ishmemi_runtime_nb_func_t **) ::malloc(sizeof(ishmemi_runtime_nb_func_t *) *
+                                                       ISHMEMI_OP_END);
+    ISHMEM_CHECK_GOTO_MSG(nb_funcs == nullptr, fn_exit, "Allocation of nb_funcs failed\n");
+    for (size_t i = 0; i < ISHMEMI_OP_END; ++i) {
+        nb_funcs[i] = (ishmemi_runtime_nb_func_t *) ::calloc(
+            ishmemi_runtime_type::proxy_func_num_types, sizeof(ishmemi_runtime_nb_func_t));
+    }
+
+    nb_funcs[ALLTOALL][UINT8] = impl::ialltoall;
+    nb_funcs[BCAST][UINT8] = impl::ibroadcast;
+    nb_funcs[FCOLLECT][UINT8] = impl::ifcollect;
+
+    nb_funcs[AND_REDUCE][UINT8] = impl::ireduce<uint8_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][UINT8] = impl::ireduce<uint8_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][UINT8] = impl::ireduce<uint8_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][UINT8] = impl::ireduce<uint8_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][UINT8] = impl::ireduce<uint8_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][UINT8] = impl::ireduce<uint8_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][UINT8] = impl::ireduce<uint8_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][UINT16] = impl::ireduce<uint16_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][UINT16] = impl::ireduce<uint16_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][UINT16] = impl::ireduce<uint16_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][UINT16] = impl::ireduce<uint16_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][UINT16] = impl::ireduce<uint16_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][UINT16] = impl::ireduce<uint16_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][UINT16] = impl::ireduce<uint16_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][UINT32] = impl::ireduce<uint32_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][UINT32] = impl::ireduce<uint32_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][UINT32] = impl::ireduce<uint32_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][UINT32] = impl::ireduce<uint32_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][UINT32] = impl::ireduce<uint32_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][UINT32] = impl::ireduce<uint32_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][UINT32] = impl::ireduce<uint32_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][UINT64] = impl::ireduce<uint64_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][UINT64] = impl::ireduce<uint64_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][UINT64] = impl::ireduce<uint64_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][UINT64] = impl::ireduce<uint64_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][UINT64] = impl::ireduce<uint64_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][UINT64] = impl::ireduce<uint64_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][UINT64] = impl::ireduce<uint64_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][ULONGLONG] = impl::ireduce<unsigned long long, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][INT8] = impl::ireduce<int8_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][INT8] = impl::ireduce<int8_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][INT8] = impl::ireduce<int8_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][INT8] = impl::ireduce<int8_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][INT8] = impl::ireduce<int8_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][INT8] = impl::ireduce<int8_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][INT8] = impl::ireduce<int8_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][INT16] = impl::ireduce<int16_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][INT16] = impl::ireduce<int16_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][INT16] = impl::ireduce<int16_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][INT16] = impl::ireduce<int16_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][INT16] = impl::ireduce<int16_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][INT16] = impl::ireduce<int16_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][INT16] = impl::ireduce<int16_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][INT32] = impl::ireduce<int32_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][INT32] = impl::ireduce<int32_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][INT32] = impl::ireduce<int32_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][INT32] = impl::ireduce<int32_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][INT32] = impl::ireduce<int32_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][INT32] = impl::ireduce<int32_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][INT32] = impl::ireduce<int32_t, PROD_REDUCE>;
+
+    nb_funcs[AND_REDUCE][INT64] = impl::ireduce<int64_t, AND_REDUCE>;
+    nb_funcs[OR_REDUCE][INT64] = impl::ireduce<int64_t, OR_REDUCE>;
+    nb_funcs[XOR_REDUCE][INT64] = impl::ireduce<int64_t, XOR_REDUCE>;
+    nb_funcs[MAX_REDUCE][INT64] = impl::ireduce<int64_t, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][INT64] = impl::ireduce<int64_t, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][INT64] = impl::ireduce<int64_t, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][INT64] = impl::ireduce<int64_t, PROD_REDUCE>;
+
+    nb_funcs[MAX_REDUCE][LONGLONG] = impl::ireduce<long long, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][LONGLONG] = impl::ireduce<long long, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][LONGLONG] = impl::ireduce<long long, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][LONGLONG] = impl::ireduce<long long, PROD_REDUCE>;
+
+    nb_funcs[MAX_REDUCE][FLOAT] = impl::ireduce<float, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][FLOAT] = impl::ireduce<float, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][FLOAT] = impl::ireduce<float, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][FLOAT] = impl::ireduce<float, PROD_REDUCE>;
+
+    nb_funcs[MAX_REDUCE][DOUBLE] = impl::ireduce<double, MAX_REDUCE>;
+    nb_funcs[MIN_REDUCE][DOUBLE] = impl::ireduce<double, MIN_REDUCE>;
+    nb_funcs[SUM_REDUCE][DOUBLE] = impl::ireduce<double, SUM_REDUCE>;
+    nb_funcs[PROD_REDUCE][DOUBLE] = impl::ireduce<double, PROD_REDUCE>;
+
 fn_exit:
     return;
 }
@@ -2189,4 +3097,11 @@ void ishmemi_runtime_mpi::funcptr_fini(void)
         ISHMEMI_FREE(::free, proxy_funcs[i]);
     }
     ISHMEMI_FREE(::free, proxy_funcs);
+
+    if (nb_funcs != nullptr) {
+        for (size_t i = 0; i < ISHMEMI_OP_END; ++i) {
+            ISHMEMI_FREE(::free, nb_funcs[i]);
+        }
+        ISHMEMI_FREE(::free, nb_funcs);
+    }
 }
@@ -12,7 +12,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <mpi.h>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "runtime.h"
 #include "wrapper.h"
@@ -39,6 +43,7 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
     void *malloc(size_t) override;
     void *calloc(size_t, size_t) override;
     void free(void *) override;
+    bool malloc_is_symmetric(void) override;
 
     /* Team APIs */
     int team_sync(ishmemi_runtime_team_t) override;
@@ -47,6 +52,8 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
     int team_split_strided(ishmemi_runtime_team_t, int, int, int,
                            const ishmemi_runtime_team_config_t *, long,
                            ishmemi_runtime_team_t *) override;
+    bool team_lazy_supported(void) override;
+    int team_create_lazy(int, int, int, int, int, ishmemi_runtime_team_t *) override;
     void team_destroy(ishmemi_runtime_team_t) override;
 
     /* Operation APIs */
@@ -67,6 +74,8 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
 
     void progress(void) override;
 
+    int request_test(void *, bool *) override;
+
     typedef struct {
         int nelems;
         int stride;
@@ -78,14 +87,19 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
     typedef struct {
         datatype_key_t key;
         MPI_Datatype datatype;
+        int refs; /* Callers that hold the datatype until their operation is issued */
         UT_hash_handle hh;
     } datatype_entry_t;
 
+    /* A lazy team has its group, rank, and size set at creation, but its comm stays MPI_COMM_NULL
+     * until team_comm first needs it */
     typedef struct team_t {
         MPI_Comm comm = MPI_COMM_NULL;
         MPI_Group group = MPI_GROUP_NULL;
         int rank = -1;
         int size = 0;
+        bool lazy = false;
+        int tag = 0; /* Tag of the communicator creation of a lazy team */
     } team_t;
 
   private:
@@ -95,12 +109,24 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
 
     /* Variables that are only needed within class methods */
     bool initialized = false;
-    bool gpu_non_contig_support = false; /* TODO: add check once supported by Intel® MPI Library */
+    /* Set by ENABLE_MPI_DATATYPES, as the MPI library must support noncontiguous GPU buffers */
+    bool gpu_non_contig_support = false;
+    /* Cache of strided datatypes, kept in least recently used order and bounded by
+     * MPI_DATATYPE_CACHE_SIZE entries.  The proxy and host threads both look up strided types, so
+     * every access holds datatype_mtx.  Entries held by a caller are never evicted, so the cache
+     * can exceed its bound while every entry is in use */
+    static std::mutex datatype_mtx;
     static datatype_entry_t *datatype_map;
+    static uint64_t datatype_hits;
+    static uint64_t datatype_misses;
+    static uint64_t datatype_evictions;
 
   public:
     /* Variables that are needed outside of class methods */
     static std::map<ishmemi_runtime_mpi_types::team_t, team_t> teams;
+    /* Serializes the creation of lazy team communicators, which the proxy and host threads may
+     * both reach for the same team */
+    static std::mutex team_comm_mtx;
     static constexpr ishmemi_runtime_mpi_types::team_t team_undefined = -1;
     static ishmemi_runtime_mpi_types::team_t world_team;
     static ishmemi_runtime_mpi_types::team_t node_team;
@@ -111,8 +137,50 @@ class ishmemi_runtime_mpi : public ishmemi_runtime_type {
     static void *global_win_base_addr;
     static size_t global_win_size;
 
+    /* Intra-node window from MPI_Win_allocate_shared over node_team.  Each node PE owns a header
+     * with one barrier counter per communicator in shm_comms, followed by a staging slot of
+     * shm_slot_size bytes, and reaches the other PEs' segments by load and store through
+     * shm_peers */
+    static constexpr size_t shm_header_size = 64;
+    static constexpr int shm_nteams = 2;
+    static MPI_Win shm_win;
+    static std::vector<uint8_t *> shm_peers;
+    static size_t shm_slot_size;
+    static MPI_Comm shm_comms[shm_nteams];
+    static std::atomic<uint64_t> shm_epochs[shm_nteams];
+
+    /* Target ranks with RMA issued since the last fence, quiet, or barrier, so that those flush
+     * only the targets this PE has talked to.  Past dirty_targets_max distinct targets, the whole
+     * window is flushed instead */
+    static constexpr size_t dirty_targets_max = 64;
+    static std::mutex dirty_mtx;
+    static std::vector<int> dirty_targets;
+    static std::vector<uint8_t> dirty_map;
+    static bool dirty_all;
+
+    /* Ring of requests for nonblocking RMA, retired in order of issue as they complete.  Each slot
+     * also holds the origin operand of an atomic, which must outlive the call that issued it */
+    static std::mutex rma_mtx;
+    static std::vector<MPI_Request> rma_requests;
+    static std::vector<uint64_t> rma_origins;
+    static std::vector<int> rma_indices;
+    static size_t rma_head;
+    static std::atomic<size_t> rma_count;
+
+    /* Progress engine state.  pending_colls counts the nonblocking collectives not yet seen
+     * complete, and progress_completions counts the requests progress found complete */
+    static std::atomic<size_t> pending_colls;
+    static std::atomic<uint64_t> progress_calls;
+    static std::atomic<uint64_t> progress_completions;
+    static std::atomic<int64_t> last_progress_ns;
+    static std::atomic<bool> progress_thread_run;
+    static std::thread progress_thread;
+
   public:
     /* Functions that are needed outside of class methods that aren't overrides of the base class */
-    static void get_strided_dt(size_t, ptrdiff_t, size_t, int, MPI_Datatype, MPI_Datatype *);
+    static MPI_Comm team_comm(ishmemi_runtime_mpi_types::team_t);
+    static int get_strided_dt(size_t, ptrdiff_t, size_t, int, MPI_Datatype, MPI_Datatype *,
+                              datatype_entry_t **);
+    static void release_strided_dt(datatype_entry_t *);
 };
 #endif /* ISHMEM_RUNTIME_MPI_H */
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "ishmem/env_utils.h"
 #include "runtime.h"
 #include "runtime_openshmem.h"
 #include "wrapper.h"
@@ -33,6 +34,49 @@
  * shares a compute node */
 #define ISHMEMI_TEAM_NODE ishmemi_openshmem_wrappers::SHMEMX_TEAM_NODE
 
+/* The proxy thread issues its RMA on a context of its own so that device quiet does not wait on
+ * operations issued by host threads.  The context is shareable so host quiet can complete it */
+static shmem_ctx_t ishmemi_openshmem_proxy_ctx;
+static bool ishmemi_openshmem_proxy_ctx_created = false;
+
+/* The context of the calling thread, which is only set on the proxy thread.  Other threads, and
+ * AMOs, signals, and collectives on every thread, use the default context */
+static thread_local shmem_ctx_t *ishmemi_openshmem_ctx = nullptr;
+
+/* Whether the proxy thread has operations outstanding on the default context */
+static thread_local bool ishmemi_openshmem_default_pending = false;
+
+/* Completes the operations on the proxy context from any thread */
+static void ishmemi_openshmem_proxy_ctx_quiet(void)
+{
+    if (ishmemi_openshmem_proxy_ctx_created)
+        ishmemi_openshmem_wrappers::ctx_quiet(ishmemi_openshmem_proxy_ctx);
+}
+
+/* Completes (or, for fence, orders) the operations of the calling thread.  On host threads this
+ * also covers the proxy context, which carries the device operations drained from the ring.  On
+ * the proxy thread fence has to complete its context, as fence only orders within a context */
+static void ishmemi_openshmem_thread_quiet(bool fence)
+{
+    if (ishmemi_openshmem_ctx == nullptr) {
+        if (fence) {
+            if (ishmemi_openshmem_proxy_ctx_created)
+                ishmemi_openshmem_wrappers::ctx_fence(ishmemi_openshmem_proxy_ctx);
+            ishmemi_openshmem_wrappers::fence();
+        } else {
+            ishmemi_openshmem_proxy_ctx_quiet();
+            ishmemi_openshmem_wrappers::quiet();
+        }
+        return;
+    }
+
+    ishmemi_openshmem_wrappers::ctx_quiet(*ishmemi_openshmem_ctx);
+    if (ishmemi_openshmem_default_pending) {
+        ishmemi_openshmem_wrappers::quiet();
+        ishmemi_openshmem_default_pending = false;
+    }
+}
+
 ishmemi_runtime_openshmem::ishmemi_runtime_openshmem(bool initialize_runtime, bool _oshmpi)
 {
     int ret = 0, tl_provided;
@@ -65,6 +109,12 @@ fn_fail:
 
 ishmemi_runtime_openshmem::~ishmemi_runtime_openshmem(void)
 {
+    /* Destroy the proxy context, which also completes its operations */
+    if (ishmemi_openshmem_proxy_ctx_created) {
+        ishmemi_openshmem_wrappers::ctx_destroy(ishmemi_openshmem_proxy_ctx);
+        ishmemi_openshmem_proxy_ctx_created = false;
+    }
+
     /* Finalize the runtime if necessary */
     if (this->initialized) {
         ishmemi_openshmem_wrappers::finalize();
@@ -85,6 +135,14 @@ void ishmemi_runtime_openshmem::heap_create(void *base, size_t size)
         ishmemi_openshmem_wrappers::heap_create(base, size, SHMEMX_EXTERNAL_HEAP_ZE, 0);
         ishmemi_openshmem_wrappers::heap_postinit();
     }
+
+    /* The proxy context is created once the heap is registered, falling back to the default
+     * context when the library has no contexts or cannot create one */
+    if (ishmemi_params.ENABLE_OPENSHMEM_CONTEXT && ishmemi_openshmem_wrappers::ctx_exists) {
+        int ret = ishmemi_openshmem_wrappers::ctx_create(0, &ishmemi_openshmem_proxy_ctx);
+        if (ret == 0) ishmemi_openshmem_proxy_ctx_created = true;
+        else ISHMEM_DEBUG_MSG("Unable to create the proxy context, using the default context\n");
+    }
 }
 
 /* Query APIs */
@@ -135,6 +193,11 @@ void ishmemi_runtime_openshmem::free(void *ptr)
     ishmemi_openshmem_wrappers::free(ptr);
 }
 
+bool ishmemi_runtime_openshmem::malloc_is_symmetric(void)
+{
+    return true;
+}
+
 /* Team APIs */
 int ishmemi_runtime_openshmem::team_sync(ishmemi_runtime_team_t team)
 {
@@ -234,6 +297,18 @@ int ishmemi_runtime_openshmem::team_split_strided(ishmemi_runtime_team_t parent_
     return ret;
 }
 
+/* OpenSHMEM teams can only be split collectively over the parent team */
+bool ishmemi_runtime_openshmem::team_lazy_supported(void)
+{
+    return false;
+}
+
+int ishmemi_runtime_openshmem::team_create_lazy(int start, int stride, int size, int team_pe,
+                                                int tag, ishmemi_runtime_team_t *new_team)
+{
+    return -1;
+}
+
 /* Operation APIs */
 void ishmemi_runtime_openshmem::abort(int exit_code, const char msg[])
 {
@@ -295,13 +370,13 @@ void ishmemi_runtime_openshmem::barrier_all(void)
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
+    ishmemi_openshmem_thread_quiet(false);
     ishmemi_openshmem_wrappers::barrier_all();
 }
 
 void ishmemi_runtime_openshmem::node_barrier(void)
 {
-    /* TODO: quiet ctx's on ISHMEMI_TEAM_NODE */
-    ishmemi_openshmem_wrappers::quiet();
+    ishmemi_openshmem_thread_quiet(false);
     ishmemi_openshmem_wrappers::team_sync(ISHMEMI_TEAM_NODE);
 }
 
@@ -311,7 +386,7 @@ void ishmemi_runtime_openshmem::fence(void)
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
-    ishmemi_openshmem_wrappers::fence();
+    ishmemi_openshmem_thread_quiet(true);
 }
 
 void ishmemi_runtime_openshmem::quiet(void)
@@ -320,7 +395,7 @@ void ishmemi_runtime_openshmem::quiet(void)
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
-    ishmemi_openshmem_wrappers::quiet();
+    ishmemi_openshmem_thread_quiet(false);
 }
 
 void ishmemi_runtime_openshmem::sync(void)
@@ -330,12 +405,19 @@ void ishmemi_runtime_openshmem::sync(void)
 
 void ishmemi_runtime_openshmem::progress(void) {}
 
+void ishmemi_runtime_openshmem::proxy_thread_init(void)
+{
+    if (ishmemi_openshmem_proxy_ctx_created) ishmemi_openshmem_ctx = &ishmemi_openshmem_proxy_ctx;
+}
+
 /* Private functions */
 /* RMA */
 int ishmemi_openshmem_uint8_put(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, PUT);
-    ishmemi_openshmem_wrappers::uint8_put(dest, src, nelems, pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_put(*ishmemi_openshmem_ctx, dest, src, nelems, pe);
+    else ishmemi_openshmem_wrappers::uint8_put(dest, src, nelems, pe);
     return 0;
 }
 
@@ -343,8 +425,10 @@ template <typename T>
 int ishmemi_openshmem_iput(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     auto wrapper = ishmemi_openshmem_wrappers::iput<T>();
+    auto ctx_wrapper = ishmemi_openshmem_wrappers::ctx_iput<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, IPUT);
-    wrapper(dest, src, dst, sst, nelems, pe);
+    if (ishmemi_openshmem_ctx) ctx_wrapper(*ishmemi_openshmem_ctx, dest, src, dst, sst, nelems, pe);
+    else wrapper(dest, src, dst, sst, nelems, pe);
     return 0;
 }
 
@@ -354,6 +438,7 @@ int ishmemi_openshmem_ibput(ishmemi_request_t *msg, ishmemi_ringcompletion_t *co
     auto wrapper = ishmemi_openshmem_wrappers::ibput<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, IBPUT);
     wrapper(dest, src, dst, sst, bsize, nelems, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -361,22 +446,29 @@ template <typename T>
 int ishmemi_openshmem_p(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     auto wrapper = ishmemi_openshmem_wrappers::p<T>();
+    auto ctx_wrapper = ishmemi_openshmem_wrappers::ctx_p<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, P);
-    wrapper(dest, val, pe);
+    if (ishmemi_openshmem_ctx) ctx_wrapper(*ishmemi_openshmem_ctx, dest, val, pe);
+    else wrapper(dest, val, pe);
     return 0;
 }
 
 int ishmemi_openshmem_uint8_put_nbi(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, PUT_NBI);
-    ishmemi_openshmem_wrappers::uint8_put_nbi(dest, src, nelems, pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_put_nbi(*ishmemi_openshmem_ctx, dest, src, nelems,
+                                                      pe);
+    else ishmemi_openshmem_wrappers::uint8_put_nbi(dest, src, nelems, pe);
     return 0;
 }
 
 int ishmemi_openshmem_uint8_get(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, GET);
-    ishmemi_openshmem_wrappers::uint8_get(dest, src, nelems, pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_get(*ishmemi_openshmem_ctx, dest, src, nelems, pe);
+    else ishmemi_openshmem_wrappers::uint8_get(dest, src, nelems, pe);
     return 0;
 }
 
@@ -384,8 +476,10 @@ template <typename T>
 int ishmemi_openshmem_iget(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     auto wrapper = ishmemi_openshmem_wrappers::iget<T>();
+    auto ctx_wrapper = ishmemi_openshmem_wrappers::ctx_iget<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, IGET);
-    wrapper(dest, src, dst, sst, nelems, pe);
+    if (ishmemi_openshmem_ctx) ctx_wrapper(*ishmemi_openshmem_ctx, dest, src, dst, sst, nelems, pe);
+    else wrapper(dest, src, dst, sst, nelems, pe);
     return 0;
 }
 
@@ -402,15 +496,21 @@ template <typename T>
 int ishmemi_openshmem_g(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     auto wrapper = ishmemi_openshmem_wrappers::g<T>();
+    auto ctx_wrapper = ishmemi_openshmem_wrappers::ctx_g<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, G);
-    ishmemi_union_set_field_value<T, G>(comp->completion.ret, wrapper(src, pe));
+    T val = (ishmemi_openshmem_ctx) ? ctx_wrapper(*ishmemi_openshmem_ctx, src, pe)
+                                    : wrapper(src, pe);
+    ishmemi_union_set_field_value<T, G>(comp->completion.ret, val);
     return 0;
 }
 
 int ishmemi_openshmem_uint8_get_nbi(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, GET_NBI);
-    ishmemi_openshmem_wrappers::uint8_get_nbi(dest, src, nelems, pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_get_nbi(*ishmemi_openshmem_ctx, dest, src, nelems,
+                                                      pe);
+    else ishmemi_openshmem_wrappers::uint8_get_nbi(dest, src, nelems, pe);
     return 0;
 }
 
@@ -421,6 +521,7 @@ int ishmemi_openshmem_atomic_fetch_nbi(ishmemi_request_t *msg, ishmemi_ringcompl
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_NBI);
     wrapper(fetch, dest, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -431,6 +532,7 @@ int ishmemi_openshmem_atomic_compare_swap_nbi(ishmemi_request_t *msg,
     auto wrapper = ishmemi_openshmem_wrappers::atomic_compare_swap_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_COMPARE_SWAP_NBI);
     wrapper(fetch, dest, cond, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -440,6 +542,7 @@ int ishmemi_openshmem_atomic_swap_nbi(ishmemi_request_t *msg, ishmemi_ringcomple
     auto wrapper = ishmemi_openshmem_wrappers::atomic_swap_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_SWAP_NBI);
     wrapper(fetch, dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -449,6 +552,7 @@ int ishmemi_openshmem_atomic_fetch_inc_nbi(ishmemi_request_t *msg, ishmemi_ringc
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_inc_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_INC_NBI);
     wrapper(fetch, dest, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -458,6 +562,7 @@ int ishmemi_openshmem_atomic_fetch_add_nbi(ishmemi_request_t *msg, ishmemi_ringc
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_add_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_ADD_NBI);
     wrapper(fetch, dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -467,6 +572,7 @@ int ishmemi_openshmem_atomic_fetch_and_nbi(ishmemi_request_t *msg, ishmemi_ringc
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_and_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_AND_NBI);
     wrapper(fetch, dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -476,6 +582,7 @@ int ishmemi_openshmem_atomic_fetch_or_nbi(ishmemi_request_t *msg, ishmemi_ringco
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_or_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_OR_NBI);
     wrapper(fetch, dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -485,6 +592,7 @@ int ishmemi_openshmem_atomic_fetch_xor_nbi(ishmemi_request_t *msg, ishmemi_ringc
     auto wrapper = ishmemi_openshmem_wrappers::atomic_fetch_xor_nbi<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_FETCH_XOR_NBI);
     wrapper(fetch, dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -504,6 +612,7 @@ int ishmemi_openshmem_atomic_set(ishmemi_request_t *msg, ishmemi_ringcompletion_
     auto wrapper = ishmemi_openshmem_wrappers::atomic_set<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_SET);
     wrapper(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -577,6 +686,7 @@ int ishmemi_openshmem_atomic_inc(ishmemi_request_t *msg, ishmemi_ringcompletion_
     auto wrapper = ishmemi_openshmem_wrappers::atomic_inc<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_INC);
     wrapper(dest, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -586,6 +696,7 @@ int ishmemi_openshmem_atomic_add(ishmemi_request_t *msg, ishmemi_ringcompletion_
     auto wrapper = ishmemi_openshmem_wrappers::atomic_add<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_ADD);
     wrapper(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -595,6 +706,7 @@ int ishmemi_openshmem_atomic_and(ishmemi_request_t *msg, ishmemi_ringcompletion_
     auto wrapper = ishmemi_openshmem_wrappers::atomic_and<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_AND);
     wrapper(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -604,6 +716,7 @@ int ishmemi_openshmem_atomic_or(ishmemi_request_t *msg, ishmemi_ringcompletion_t
     auto wrapper = ishmemi_openshmem_wrappers::atomic_or<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_OR);
     wrapper(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -613,6 +726,7 @@ int ishmemi_openshmem_atomic_xor(ishmemi_request_t *msg, ishmemi_ringcompletion_
     auto wrapper = ishmemi_openshmem_wrappers::atomic_xor<T>();
     ISHMEMI_RUNTIME_REQUEST_HELPER(T, AMO_XOR);
     wrapper(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -620,15 +734,24 @@ int ishmemi_openshmem_atomic_xor(ishmemi_request_t *msg, ishmemi_ringcompletion_
 int ishmemi_openshmem_uint8_put_signal(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, PUT_SIGNAL);
-    ishmemi_openshmem_wrappers::uint8_put_signal(dest, src, nelems, sig_addr, signal, sig_op, pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_put_signal(*ishmemi_openshmem_ctx, dest, src, nelems,
+                                                         sig_addr, signal, sig_op, pe);
+    else
+        ishmemi_openshmem_wrappers::uint8_put_signal(dest, src, nelems, sig_addr, signal, sig_op,
+                                                     pe);
     return 0;
 }
 
 int ishmemi_openshmem_uint8_put_signal_nbi(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, PUT_SIGNAL_NBI);
-    ishmemi_openshmem_wrappers::uint8_put_signal_nbi(dest, src, nelems, sig_addr, signal, sig_op,
-                                                     pe);
+    if (ishmemi_openshmem_ctx)
+        ishmemi_openshmem_wrappers::ctx_uint8_put_signal_nbi(*ishmemi_openshmem_ctx, dest, src,
+                                                             nelems, sig_addr, signal, sig_op, pe);
+    else
+        ishmemi_openshmem_wrappers::uint8_put_signal_nbi(dest, src, nelems, sig_addr, signal,
+                                                         sig_op, pe);
     return 0;
 }
 
@@ -644,6 +767,7 @@ int ishmemi_openshmem_signal_add(ishmemi_request_t *msg, ishmemi_ringcompletion_
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint64_t, AMO_ADD);
     /* TODO: Use signal add */
     ishmemi_openshmem_wrappers::uint64_atomic_add(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -652,6 +776,7 @@ int ishmemi_openshmem_signal_set(ishmemi_request_t *msg, ishmemi_ringcompletion_
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint64_t, AMO_SET);
     /* TODO: Use signal set */
     ishmemi_openshmem_wrappers::uint64_atomic_set(dest, val, pe);
+    ishmemi_openshmem_default_pending = true;
     return 0;
 }
 
@@ -684,6 +809,7 @@ int ishmemi_openshmem_barrier_all(ishmemi_request_t *msg, ishmemi_ringcompletion
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
+    ishmemi_openshmem_thread_quiet(false);
     ishmemi_openshmem_wrappers::barrier_all();
     return 0;
 }
@@ -702,6 +828,42 @@ int ishmemi_openshmem_uint8_alltoall(ishmemi_request_t *msg, ishmemi_ringcomplet
     return comp->completion.ret.i;
 }
 
+template <typename T>
+int ishmemi_openshmem_alltoalls(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+{
+    ISHMEMI_RUNTIME_REQUEST_HELPER(T, ALLTOALLS);
+    comp->completion.ret.i = ishmemi_openshmem_wrappers::alltoalls<T>()(
+        team_ptr->runtime_team.shmem, dest, src, dst, sst, nelems);
+    return comp->completion.ret.i;
+}
+
+/* OpenSHMEM has no alltoallv, so each PE reads its offset in every peer's dest_offsets and puts its
+ * block there directly.  The entry sync assures every peer has set its offsets and is done reading
+ * its dest, as the device path does */
+template <typename T>
+int ishmemi_openshmem_alltoallv(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+{
+    ISHMEMI_RUNTIME_REQUEST_HELPER(T, ALLTOALLV);
+    const size_t *src_offsets = ISHMEMI_HOST_READABLE_ADDR(const size_t, msg->src_offsets);
+    const size_t *src_nelems = ISHMEMI_HOST_READABLE_ADDR(const size_t, msg->src_nelems);
+    const uint64_t *remote_offset = (const uint64_t *) &msg->dest_offsets[team_ptr->my_pe];
+
+    comp->completion.ret.i = ishmemi_openshmem_wrappers::team_sync(team_ptr->runtime_team.shmem);
+    if (comp->completion.ret.i != 0) return comp->completion.ret.i;
+
+    for (int i = 0; i < team_ptr->size; ++i) {
+        int peer = (team_ptr->my_pe + i) % team_ptr->size;
+        int peer_pe = ishmemi_team_pe(team_ptr, peer);
+        size_t offset = (size_t) ishmemi_openshmem_wrappers::uint64_g(remote_offset, peer_pe);
+        ishmemi_openshmem_wrappers::uint8_put_nbi(
+            (uint8_t *) (dest + offset), (const uint8_t *) (src + src_offsets[peer]),
+            src_nelems[peer] * sizeof(T), peer_pe);
+    }
+    ishmemi_openshmem_wrappers::quiet();
+    comp->completion.ret.i = ishmemi_openshmem_wrappers::team_sync(team_ptr->runtime_team.shmem);
+    return comp->completion.ret.i;
+}
+
 int ishmemi_openshmem_uint8_broadcast(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
 {
     ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, BCAST);
@@ -1083,7 +1245,7 @@ int ishmemi_openshmem_fence(ishmemi_request_t *msg, ishmemi_ringcompletion_t *co
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
-    ishmemi_openshmem_wrappers::fence();
+    ishmemi_openshmem_thread_quiet(true);
     return 0;
 }
 
@@ -1093,7 +1255,7 @@ int ishmemi_openshmem_quiet(ishmemi_request_t *msg, ishmemi_ringcompletion_t *co
     ishmemi_level_zero_sync();
 
     /* Ensure all operations faciliated by OpenSHMEM backend are finished */
-    ishmemi_openshmem_wrappers::quiet();
+    ishmemi_openshmem_thread_quiet(false);
     return 0;
 }
 
@@ -1330,6 +1492,14 @@ void ishmemi_runtime_openshmem::funcptr_init()
     proxy_funcs[BARRIER][NONE] = ishmemi_openshmem_barrier_all;
     proxy_funcs[SYNC][NONE] = ishmemi_openshmem_sync_all;
     proxy_funcs[ALLTOALL][UINT8] = ishmemi_openshmem_uint8_alltoall;
+    proxy_funcs[ALLTOALLS][UINT8] = ishmemi_openshmem_alltoalls<uint8_t>;
+    proxy_funcs[ALLTOALLS][UINT16] = ishmemi_openshmem_alltoalls<uint16_t>;
+    proxy_funcs[ALLTOALLS][UINT32] = ishmemi_openshmem_alltoalls<uint32_t>;
+    proxy_funcs[ALLTOALLS][UINT64] = ishmemi_openshmem_alltoalls<uint64_t>;
+    proxy_funcs[ALLTOALLV][UINT8] = ishmemi_openshmem_alltoallv<uint8_t>;
+    proxy_funcs[ALLTOALLV][UINT16] = ishmemi_openshmem_alltoallv<uint16_t>;
+    proxy_funcs[ALLTOALLV][UINT32] = ishmemi_openshmem_alltoallv<uint32_t>;
+    proxy_funcs[ALLTOALLV][UINT64] = ishmemi_openshmem_alltoallv<uint64_t>;
     proxy_funcs[BCAST][UINT8] = ishmemi_openshmem_uint8_broadcast;
     proxy_funcs[COLLECT][UINT8] = ishmemi_openshmem_uint8_collect;
     proxy_funcs[FCOLLECT][UINT8] = ishmemi_openshmem_uint8_fcollect;
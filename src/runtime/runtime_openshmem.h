@@ -54,6 +54,7 @@ class ishmemi_runtime_openshmem : public ishmemi_runtime_type {
     void *malloc(size_t) override;
     void *calloc(size_t, size_t) override;
     void free(void *) override;
+    bool malloc_is_symmetric(void) override;
 
     /* Team APIs */
     int team_sync(ishmemi_runtime_team_t) override;
@@ -62,6 +63,8 @@ class ishmemi_runtime_openshmem : public ishmemi_runtime_type {
     int team_split_strided(ishmemi_runtime_team_t, int, int, int,
                            const ishmemi_runtime_team_config_t *, long,
                            ishmemi_runtime_team_t *) override;
+    bool team_lazy_supported(void) override;
+    int team_create_lazy(int, int, int, int, int, ishmemi_runtime_team_t *) override;
     void team_destroy(ishmemi_runtime_team_t) override;
 
     /* Operation APIs */
@@ -81,6 +84,7 @@ class ishmemi_runtime_openshmem : public ishmemi_runtime_type {
     void sync(void) override;
 
     void progress(void) override;
+    void proxy_thread_init(void) override;
 
   private:
     int team_sanity_checks(ishmemi_runtime_team_predefined_t, int, int, int, int, int, int);
@@ -12,13 +12,33 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <immintrin.h>
 #include "pmi.h"
 
+#include "ishmem/env_utils.h"
+#include "accelerator.h"
 #include "runtime.h"
+#include "runtime_ipc.h"
 #include "runtime_pmi.h"
 #include "wrapper.h"
 #include "uthash.h"
 
+#define PMI_CHECK_GOTO(label, call)                                                                \
+    do {                                                                                           \
+        int pmi_err = call;                                                                        \
+        if (pmi_err != PMI_SUCCESS) {                                                              \
+            fprintf(stderr, "PMI FAIL: call = '%s' result = '%d'\n", #call, pmi_err);              \
+            ret = pmi_err;                                                                         \
+            goto label;                                                                            \
+        }                                                                                          \
+    } while (0)
+
 #define PMI_CHECK(call)                                                                            \
     do {                                                                                           \
         int pmi_err = call;                                                                        \
@@ -28,45 +48,534 @@
         }                                                                                          \
     } while (0)
 
+namespace {
+    /* PMI values are strings, so binary values travel hex-encoded */
+    void kvs_encode(char *out, const void *value, size_t valuelen)
+    {
+        static const char digits[] = "0123456789abcdef";
+        const uint8_t *in = static_cast<const uint8_t *>(value);
+        for (size_t i = 0; i < valuelen; i++) {
+            out[2 * i] = digits[in[i] >> 4];
+            out[2 * i + 1] = digits[in[i] & 0xf];
+        }
+        out[2 * valuelen] = '\0';
+    }
+
+    int kvs_decode(void *value, size_t valuelen, const char *in)
+    {
+        uint8_t *out = static_cast<uint8_t *>(value);
+        size_t len = strlen(in) / 2;
+        for (size_t i = 0; i < len && i < valuelen; i++) {
+            unsigned int byte = 0;
+            if (sscanf(&in[2 * i], "%2x", &byte) != 1) return -1;
+            out[i] = static_cast<uint8_t>(byte);
+        }
+        return 0;
+    }
+
+    inline int team_pe(const ishmemi_runtime_pmi::team_t &team, int team_rank)
+    {
+        return team.start + team_rank * team.stride;
+    }
+
+    inline uint64_t *shm_counter(ishmemi_runtime_pmi_types::team_t idx, int pe)
+    {
+        size_t npes = static_cast<size_t>(
+            ishmemi_runtime_pmi::teams[ishmemi_runtime_pmi::world_team].size);
+        size_t line = static_cast<size_t>(idx) * npes + static_cast<size_t>(pe);
+        return reinterpret_cast<uint64_t *>(ishmemi_runtime_pmi::shm_base +
+                                            line * ishmemi_runtime_pmi::shm_line_size);
+    }
+
+    inline uint8_t *shm_slot(int pe)
+    {
+        size_t npes = static_cast<size_t>(
+            ishmemi_runtime_pmi::teams[ishmemi_runtime_pmi::world_team].size);
+        size_t header = ishmemi_runtime_pmi::teams.size() * npes;
+        return ishmemi_runtime_pmi::shm_base + header * ishmemi_runtime_pmi::shm_line_size +
+               static_cast<size_t>(pe) * ishmemi_runtime_pmi::shm_slot_size;
+    }
+
+    /* Host address of a buffer that may be in this PE's part of the device heap */
+    template <typename T>
+    inline T *host_addr(T *p)
+    {
+        if (!ISHMEMI_HOST_IN_HEAP(p) || ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP) return p;
+        return ISHMEMI_DEVICE_TO_MMAP_ADDR(T, p);
+    }
+
+    /* Each member publishes how many syncs of the team it has entered, counted from its counter on
+     * the team's row when the team was created, and waits for every member to reach the same
+     * count.  Counters only grow, so a row is reused without resetting them, and a thread that
+     * drew an earlier epoch never lowers the count another thread published */
+    void team_sync_impl(ishmemi_runtime_pmi_types::team_t idx)
+    {
+        ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        if (team.size <= 1) return;
+
+        uint64_t epoch = __atomic_add_fetch(&team.epoch, 1, __ATOMIC_RELAXED);
+        uint64_t *my_counter = shm_counter(idx, team_pe(team, team.rank));
+        uint64_t target = team.base[team.rank] + epoch;
+        uint64_t published = __atomic_load_n(my_counter, __ATOMIC_RELAXED);
+        while (published < target &&
+               !__atomic_compare_exchange_n(my_counter, &published, target, true, __ATOMIC_RELEASE,
+                                            __ATOMIC_RELAXED)) {
+        }
+        for (int i = 0; i < team.size; i++) {
+            if (i == team.rank) continue;
+            uint64_t *counter = shm_counter(idx, team_pe(team, i));
+            while (__atomic_load_n(counter, __ATOMIC_ACQUIRE) < team.base[i] + epoch) {
+                _mm_pause();
+            }
+        }
+    }
+
+    template <typename T, ishmemi_op_t OP>
+    inline T reduce_op(T a, T b)
+    {
+        if constexpr (OP == AND_REDUCE) return static_cast<T>(a & b);
+        else if constexpr (OP == OR_REDUCE) return static_cast<T>(a | b);
+        else if constexpr (OP == XOR_REDUCE) return static_cast<T>(a ^ b);
+        else if constexpr (OP == MAX_REDUCE) return std::max(a, b);
+        else if constexpr (OP == MIN_REDUCE) return std::min(a, b);
+        else if constexpr (OP == SUM_REDUCE) return static_cast<T>(a + b);
+        else return static_cast<T>(a * b);
+    }
+
+    /* Every member stages a chunk of source in its slot, then combines the slots of all members,
+     * so a reduction costs two syncs per slot-sized chunk */
+    template <typename T, typename F>
+    int reduce_impl(ishmemi_runtime_pmi_types::team_t idx, T *dest, const T *source,
+                    size_t nreduce, F op)
+    {
+        const ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        size_t chunk = ishmemi_runtime_pmi::shm_slot_size / sizeof(T);
+        if (team.rank < 0) return -1;
+
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_pmi::coll_mtx);
+        for (size_t offset = 0; offset < nreduce; offset += chunk) {
+            size_t count = std::min(chunk, nreduce - offset);
+            ::memcpy(shm_slot(team_pe(team, team.rank)), source + offset, count * sizeof(T));
+            team_sync_impl(idx);
+
+            ::memcpy(dest + offset, shm_slot(team.start), count * sizeof(T));
+            for (int i = 1; i < team.size; i++) {
+                const T *peer = reinterpret_cast<const T *>(shm_slot(team_pe(team, i)));
+                for (size_t j = 0; j < count; j++) {
+                    dest[offset + j] = op(dest[offset + j], peer[j]);
+                }
+            }
+            team_sync_impl(idx);
+        }
+        return 0;
+    }
+
+    /* The root stages each chunk of source in its slot, from which the other members copy it */
+    int bcast_impl(ishmemi_runtime_pmi_types::team_t idx, void *dest, const void *source,
+                   size_t count, int root)
+    {
+        const ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        if (team.rank < 0 || root < 0 || root >= team.size) return -1;
+        uint8_t *root_slot = shm_slot(team_pe(team, root));
+
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_pmi::coll_mtx);
+        for (size_t offset = 0; offset < count; offset += ishmemi_runtime_pmi::shm_slot_size) {
+            size_t nbytes = std::min(ishmemi_runtime_pmi::shm_slot_size, count - offset);
+            if (team.rank == root) ::memcpy(root_slot, pointer_offset(source, offset), nbytes);
+            team_sync_impl(idx);
+            if (team.rank != root) ::memcpy(pointer_offset(dest, offset), root_slot, nbytes);
+            team_sync_impl(idx);
+        }
+        if (team.rank == root && dest != source) ::memmove(dest, source, count);
+        return 0;
+    }
+
+    /* Every member stages a chunk of source in its slot and copies the chunks of all members to
+     * their places in dest, count bytes apart */
+    int fcollect_impl(ishmemi_runtime_pmi_types::team_t idx, void *dest, const void *source,
+                      size_t count)
+    {
+        const ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        if (team.rank < 0) return -1;
+
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_pmi::coll_mtx);
+        for (size_t offset = 0; offset < count; offset += ishmemi_runtime_pmi::shm_slot_size) {
+            size_t nbytes = std::min(ishmemi_runtime_pmi::shm_slot_size, count - offset);
+            ::memcpy(shm_slot(team_pe(team, team.rank)), pointer_offset(source, offset), nbytes);
+            team_sync_impl(idx);
+            for (int i = 0; i < team.size; i++) {
+                ::memcpy(pointer_offset(dest, static_cast<size_t>(i) * count + offset),
+                         shm_slot(team_pe(team, i)), nbytes);
+            }
+            team_sync_impl(idx);
+        }
+        return 0;
+    }
+
+    /* As fcollect_impl, after the members have traded their counts through the slots, so that
+     * each contribution lands right after the previous member's */
+    int collect_impl(ishmemi_runtime_pmi_types::team_t idx, void *dest, const void *source,
+                     size_t count)
+    {
+        const ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        if (team.rank < 0) return -1;
+        std::vector<size_t> counts(static_cast<size_t>(team.size));
+        std::vector<size_t> displs(static_cast<size_t>(team.size));
+        size_t max_count = 0, total = 0;
+
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_pmi::coll_mtx);
+        ::memcpy(shm_slot(team_pe(team, team.rank)), &count, sizeof(size_t));
+        team_sync_impl(idx);
+        for (int i = 0; i < team.size; i++) {
+            ::memcpy(&counts[i], shm_slot(team_pe(team, i)), sizeof(size_t));
+            displs[i] = total;
+            total += counts[i];
+            max_count = std::max(max_count, counts[i]);
+        }
+        team_sync_impl(idx);
+
+        for (size_t offset = 0; offset < max_count; offset += ishmemi_runtime_pmi::shm_slot_size) {
+            size_t nbytes = (offset < count)
+                                ? std::min(ishmemi_runtime_pmi::shm_slot_size, count - offset)
+                                : 0;
+            ::memcpy(shm_slot(team_pe(team, team.rank)), pointer_offset(source, offset), nbytes);
+            team_sync_impl(idx);
+            for (int i = 0; i < team.size; i++) {
+                if (offset >= counts[i]) continue;
+                nbytes = std::min(ishmemi_runtime_pmi::shm_slot_size, counts[i] - offset);
+                ::memcpy(pointer_offset(dest, displs[i] + offset), shm_slot(team_pe(team, i)),
+                         nbytes);
+            }
+            team_sync_impl(idx);
+        }
+        return 0;
+    }
+
+    /* The slot is split into one part per member.  Each round, every member stages the next chunk
+     * of each of its blocks in the part of that block's destination, then copies its own part out
+     * of every member's slot */
+    int alltoall_impl(ishmemi_runtime_pmi_types::team_t idx, void *dest, const void *source,
+                      size_t count)
+    {
+        const ishmemi_runtime_pmi::team_t &team = ishmemi_runtime_pmi::teams[idx];
+        size_t chunk = ishmemi_runtime_pmi::shm_slot_size / static_cast<size_t>(team.size);
+        if (team.rank < 0) return -1;
+        if (chunk == 0) {
+            ISHMEM_WARN_MSG("ISHMEM_PMI_SHARED_SLOT_SIZE must be at least %d for alltoall\n",
+                            team.size);
+            return -1;
+        }
+
+        const std::lock_guard<std::mutex> lock(ishmemi_runtime_pmi::coll_mtx);
+        uint8_t *my_slot = shm_slot(team_pe(team, team.rank));
+        for (size_t offset = 0; offset < count; offset += chunk) {
+            size_t nbytes = std::min(chunk, count - offset);
+            for (int i = 0; i < team.size; i++) {
+                ::memcpy(my_slot + static_cast<size_t>(i) * chunk,
+                         pointer_offset(source, static_cast<size_t>(i) * count + offset), nbytes);
+            }
+            team_sync_impl(idx);
+            for (int i = 0; i < team.size; i++) {
+                ::memcpy(pointer_offset(dest, static_cast<size_t>(i) * count + offset),
+                         shm_slot(team_pe(team, i)) + static_cast<size_t>(team.rank) * chunk,
+                         nbytes);
+            }
+            team_sync_impl(idx);
+        }
+        return 0;
+    }
+
+    /* Polls an ivar of this PE through its host address until the comparison holds, returning
+     * the satisfying value in value */
+    template <typename T>
+    int wait_impl(const T *ivar, T cmp_value, int cmp, T *value)
+    {
+        while (true) {
+            T result = __atomic_load_n(ivar, __ATOMIC_ACQUIRE);
+            int ret = ishmemi_comparison(result, cmp_value, cmp);
+            if (ret == -1) return -1;
+            if (ret == 1) {
+                if (value) *value = result;
+                return 0;
+            }
+            _mm_pause();
+        }
+    }
+
+    /* Proxy functions.  Every PE is on this node, so data moves through the IPC mappings of the
+     * symmetric heap */
+    namespace impl {
+        /* RMA */
+        template <typename T, ishmemi_op_t OP, bool BLOCKING = true>
+        int put(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+
+            if constexpr (OP == P) return ishmemi_ipc_put(dest, &val, 1, pe);
+            else if constexpr (BLOCKING) return ishmemi_ipc_put(dest, src, nelems, pe);
+            else return ishmemi_ipc_put_nbi(dest, src, nelems, pe);
+        }
+
+        template <typename T, ishmemi_op_t OP, bool BLOCKING = true>
+        int get(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            T result;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+
+            if constexpr (OP == G) {
+                ret = ishmemi_ipc_get(&result, src, 1, pe);
+                ishmemi_union_set_field_value<T, G>(comp->completion.ret, result);
+            } else if constexpr (BLOCKING) {
+                ret = ishmemi_ipc_get(dest, src, nelems, pe);
+            } else {
+                ret = ishmemi_ipc_get_nbi(dest, src, nelems, pe);
+            }
+            return ret;
+        }
+
+        /* Strided RMA issues one nonblocking copy per block and completes them together */
+        template <typename T, ishmemi_op_t OP>
+        int iput(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+
+            if constexpr (OP == IPUT) bsize = 1;
+
+            for (size_t i = 0; i < nelems; i++) {
+                ret = ishmemi_ipc_put_nbi(dest + i * static_cast<size_t>(dst),
+                                          src + i * static_cast<size_t>(sst), bsize, pe);
+                ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+            }
+
+        fn_exit:
+            ishmemi_level_zero_sync();
+            return ret;
+        }
+
+        template <typename T, ishmemi_op_t OP>
+        int iget(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+
+            if constexpr (OP == IGET) bsize = 1;
+
+            for (size_t i = 0; i < nelems; i++) {
+                ret = ishmemi_ipc_get_nbi(dest + i * static_cast<size_t>(dst),
+                                          src + i * static_cast<size_t>(sst), bsize, pe);
+                ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+            }
+
+        fn_exit:
+            ishmemi_level_zero_sync();
+            return ret;
+        }
+
+        /* The blocking data copy completes before the signal is written, which orders the two.
+         * Without device-scope atomics reachable from the host, only ISHMEM_SIGNAL_SET is
+         * supported */
+        int put_signal(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, PUT_SIGNAL);
+
+            ISHMEM_CHECK_GOTO_MSG(sig_op != ISHMEM_SIGNAL_SET, fn_fail,
+                                  "The PMI runtime only supports ISHMEM_SIGNAL_SET\n");
+            ret = ishmemi_ipc_put(dest, src, nelems, pe);
+            ISHMEMI_CHECK_RESULT(ret, 0, fn_exit);
+            ret = ishmemi_ipc_put(sig_addr, &signal, 1, pe);
+
+        fn_exit:
+            return ret;
+        fn_fail:
+            ret = -1;
+            goto fn_exit;
+        }
+
+        int signal_set(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint64_t, SIGNAL_SET);
+            return ishmemi_ipc_put(dest, &val, 1, pe);
+        }
+
+        int signal_fetch(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            uint64_t result = 0;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint64_t, SIGNAL_FETCH);
+
+            ret = ishmemi_ipc_get(&result, sig_addr, 1, ishmemi_my_pe);
+            comp->completion.ret.ui64 = result;
+            return ret;
+        }
+
+        int signal_wait_until(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            int ret = 0;
+            uint64_t result = 0;
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint64_t, SIGNAL_WAIT_UNTIL);
+
+            ret = wait_impl(host_addr(static_cast<const uint64_t *>(sig_addr)), cmp_value, cmp,
+                            &result);
+            comp->completion.ret.ui64 = result;
+            return ret;
+        }
+
+        /* Point-to-point synchronization, on ivars of this PE */
+        template <typename T, ishmemi_op_t OP>
+        int test(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+
+            T value = __atomic_load_n(host_addr(static_cast<const T *>(dest)), __ATOMIC_ACQUIRE);
+            comp->completion.ret.i = ishmemi_comparison(value, cmp_value, cmp);
+            return (comp->completion.ret.i == -1) ? -1 : 0;
+        }
+
+        template <typename T, ishmemi_op_t OP>
+        int wait_until(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+            return wait_impl(host_addr(static_cast<const T *>(dest)), cmp_value, cmp,
+                             (T *) nullptr);
+        }
+
+        /* Synchronization */
+        int fence(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ishmemi_level_zero_sync();
+            return 0;
+        }
+
+        int quiet(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ishmemi_level_zero_sync();
+            return 0;
+        }
+
+        int barrier(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ishmemi_level_zero_sync();
+            team_sync_impl(ishmemi_runtime_pmi::world_team);
+            return 0;
+        }
+
+        template <ishmemi_op_t OP>
+        int sync(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, OP);
+
+            if constexpr (ishmemi_op_uses_team<OP>()) team_sync_impl(team_ptr->runtime_team.pmi);
+            else team_sync_impl(ishmemi_runtime_pmi::world_team);
+            return 0;
+        }
+
+        /* Collectives.  The buffers are this PE's, so the host reaches them through its mapping of
+         * the heap and the data moves through the slots */
+        int alltoall(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, ALLTOALL);
+            comp->completion.ret.i =
+                alltoall_impl(team_ptr->runtime_team.pmi, host_addr(dest), host_addr(src), nelems);
+            return comp->completion.ret.i;
+        }
+
+        int broadcast(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, BCAST);
+            comp->completion.ret.i = bcast_impl(team_ptr->runtime_team.pmi, host_addr(dest),
+                                                host_addr(src), nelems, root);
+            return comp->completion.ret.i;
+        }
+
+        int collect(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, COLLECT);
+            comp->completion.ret.i =
+                collect_impl(team_ptr->runtime_team.pmi, host_addr(dest), host_addr(src), nelems);
+            return comp->completion.ret.i;
+        }
+
+        int fcollect(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, FCOLLECT);
+            comp->completion.ret.i =
+                fcollect_impl(team_ptr->runtime_team.pmi, host_addr(dest), host_addr(src), nelems);
+            return comp->completion.ret.i;
+        }
+
+        template <typename T, ishmemi_op_t OP>
+        int reduce(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(T, OP);
+            comp->completion.ret.i = reduce_impl(team_ptr->runtime_team.pmi, host_addr(dest),
+                                                 host_addr(src), nelems, reduce_op<T, OP>);
+            return comp->completion.ret.i;
+        }
+
+        /* Teams */
+        int team_my_pe(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, TEAM_MY_PE);
+            comp->completion.ret.i = ishmemi_runtime_pmi::teams[team_ptr->runtime_team.pmi].rank;
+            return comp->completion.ret.i;
+        }
+
+        int team_n_pes(ishmemi_request_t *msg, ishmemi_ringcompletion_t *comp)
+        {
+            ISHMEMI_RUNTIME_REQUEST_HELPER(uint8_t, TEAM_N_PES);
+            comp->completion.ret.i = ishmemi_runtime_pmi::teams[team_ptr->runtime_team.pmi].size;
+            return comp->completion.ret.i;
+        }
+    }  // namespace impl
+}  // namespace
+
+/* Static member declarations */
+std::vector<ishmemi_runtime_pmi::team_t> ishmemi_runtime_pmi::teams;
+void *ishmemi_runtime_pmi::heap_base = nullptr;
+size_t ishmemi_runtime_pmi::heap_length = 0;
+uint8_t *ishmemi_runtime_pmi::shm_base = nullptr;
+size_t ishmemi_runtime_pmi::shm_length = 0;
+size_t ishmemi_runtime_pmi::shm_slot_size = 0;
+std::mutex ishmemi_runtime_pmi::coll_mtx;
+
 ishmemi_runtime_pmi::ishmemi_runtime_pmi(bool initialize_runtime)
 {
     int ret = 0, initialized = 0;
 
     /* Setup PMI dlsym links */
     ret = ishmemi_pmi_wrappers::init_wrappers();
+    ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "Failed to load PMI library\n");
 
     /* Initialize the runtime if requested */
     if (initialize_runtime) {
-        PMI_CHECK(ishmemi_pmi_wrappers::Init(&initialized));
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Init(&initialized));
         this->initialized = true;
     }
 
-    PMI_CHECK(ishmemi_pmi_wrappers::Initialized(&initialized));
+    PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Initialized(&initialized));
 
     if (!initialized) {
-        PMI_CHECK(ishmemi_pmi_wrappers::Init(&initialized));
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Init(&initialized));
         this->initialized = true;
     }
 
-    PMI_CHECK(ishmemi_pmi_wrappers::Get_rank(&this->rank));
-    PMI_CHECK(ishmemi_pmi_wrappers::Get_size(&this->size));
+    PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Get_rank(&this->rank));
+    PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Get_size(&this->size));
 
     if (size > 1) {
-        PMI_CHECK(ishmemi_pmi_wrappers::KVS_Get_name_length_max(&this->max_name_len));
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Get_name_length_max(&this->max_name_len));
 
         this->kvs_name = (char *) ::malloc(this->max_name_len);
         ISHMEM_CHECK_GOTO_MSG(this->kvs_name == nullptr, fn_fail,
                               "Allocation of kvs_name failed\n");
 
-        PMI_CHECK(ishmemi_pmi_wrappers::KVS_Get_key_length_max(&this->max_key_len));
-        PMI_CHECK(ishmemi_pmi_wrappers::KVS_Get_value_length_max(&this->max_val_len));
-        PMI_CHECK(ishmemi_pmi_wrappers::KVS_Get_my_name(kvs_name, max_name_len));
-
-        /* TODO: Fix later for XPMEM */
-        /*if (enable_node_ranks) {
-            location_array = (int *) ::malloc(sizeof(int) * size);
-            if (nullptr == location_array) return 10;
-        }*/
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Get_key_length_max(&this->max_key_len));
+        PMI_CHECK_GOTO(fn_fail,
+                       ishmemi_pmi_wrappers::KVS_Get_value_length_max(&this->max_val_len));
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Get_my_name(kvs_name, max_name_len));
     } else {
         /* Use a local KVS for singleton runs */
         this->max_key_len = this->SINGLETON_KEY_LEN;
@@ -81,6 +590,17 @@ ishmemi_runtime_pmi::ishmemi_runtime_pmi(bool initialize_runtime)
     this->kvs_value = (char *) ::malloc(this->max_val_len);
     ISHMEM_CHECK_GOTO_MSG(this->kvs_value == nullptr, fn_fail, "Allocation of kvs_value failed\n");
 
+    /* Row world_team spans every PE and row self_team holds only this PE.  The remaining rows are
+     * handed out by team_split_strided */
+    teams.assign(std::max(ishmemi_params.TEAMS_MAX, (size_t) 2), team_t{});
+    teams[world_team] = {0, 1, this->size, this->rank, 0, std::vector<uint64_t>(this->size, 0),
+                         true};
+    teams[self_team] = {this->rank, 1, 1, 0, 0, std::vector<uint64_t>(1, 0), true};
+
+    /* Map the shared segment used for host-side synchronization and collectives */
+    ret = this->shm_init();
+    ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "Failed to set up the PMI shared-memory segment\n");
+
     /* Initialize the function pointer table */
     this->funcptr_init();
 
@@ -91,8 +611,20 @@ fn_fail:
 ishmemi_runtime_pmi::~ishmemi_runtime_pmi(void)
 {
     int ret = 0;
+    singleton_kvs_t *entry = nullptr, *tmp = nullptr;
+
+    /* Release the shared segment */
+    this->shm_fini();
+    teams.clear();
+    heap_base = nullptr;
+    heap_length = 0;
 
     /* Cleanup the internal runtime info */
+    HASH_ITER(hh, this->singleton_kvs, entry, tmp)
+    {
+        HASH_DEL(this->singleton_kvs, entry);
+        ::free(entry);
+    }
     ::free(this->location_array);
     ::free(this->kvs_name);
     ::free(this->kvs_key);
@@ -106,11 +638,16 @@ ishmemi_runtime_pmi::~ishmemi_runtime_pmi(void)
 
     /* Cleanup the function pointer table */
     this->funcptr_fini();
+
+    /* Close the shared library */
+    ishmemi_pmi_wrappers::fini_wrappers();
 }
 
 void ishmemi_runtime_pmi::heap_create(void *base, size_t size)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    /* Data moves through the IPC mappings of the heap, so only its bounds are recorded */
+    heap_base = base;
+    heap_length = size;
 }
 
 /* Query APIs */
@@ -126,39 +663,28 @@ int ishmemi_runtime_pmi::get_size(void)
 
 int ishmemi_runtime_pmi::get_node_rank(int pe)
 {
-    /* TODO - Fix implementation */
     if (pe >= size || pe < 0) {
         std::cout << "[ERROR] Wrong PE value " << pe << std::endl;
         this->abort(1, "Wrong PE value");
     }
 
-    if (size == 1) {
-        return 0;
-    } else {
-        return location_array[pe];
-    }
+    return location_array[pe];
 }
 
 int ishmemi_runtime_pmi::get_node_size(void)
 {
-    /* TODO - Fix implementation */
-    if (size == 1) {
-        return 1;
-    } else {
-        return node_size;
-    }
+    return node_size;
 }
 
 bool ishmemi_runtime_pmi::is_local(int pe)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return false;
+    return (this->get_node_rank(pe) != -1);
 }
 
 bool ishmemi_runtime_pmi::is_symmetric_address(const void *addr)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return false;
+    return ((uintptr_t) addr >= (uintptr_t) heap_base) &&
+           ((uintptr_t) addr < ((uintptr_t) heap_base + heap_length));
 }
 
 /* Memory APIs */
@@ -177,11 +703,17 @@ void ishmemi_runtime_pmi::free(void *ptr)
     ::free(ptr);
 }
 
+bool ishmemi_runtime_pmi::malloc_is_symmetric(void)
+{
+    return false;
+}
+
 /* Team APIs */
 int ishmemi_runtime_pmi::team_sync(ishmemi_runtime_team_t team)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    if (team.pmi == team_undefined) return -1;
+    team_sync_impl(team.pmi);
+    return 0;
 }
 
 int ishmemi_runtime_pmi::team_predefined_set(ishmemi_runtime_team_t *team,
@@ -189,8 +721,29 @@ int ishmemi_runtime_pmi::team_predefined_set(ishmemi_runtime_team_t *team,
                                              int expected_team_size, int expected_world_pe,
                                              int expected_team_pe)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    int ret = 0;
+
+    /* Every PE is on this node, so the node team is the world team */
+    switch (predefined_team_name) {
+        case WORLD:
+        case NODE:
+            team->pmi = world_team;
+            break;
+        case SHARED:
+            /* The shared team holds only this PE when ISHMEM_ENABLE_GPU_IPC=0 */
+            team->pmi = (expected_team_size == 1) ? self_team : world_team;
+            break;
+        default:
+            return -3;
+    }
+
+    if (teams[team->pmi].size != expected_team_size) {
+        ret = -1;
+    } else if (teams[team->pmi].rank != expected_team_pe) {
+        ret = -2;
+    }
+
+    return ret;
 }
 
 int ishmemi_runtime_pmi::team_split_strided(ishmemi_runtime_team_t parent_team, int PE_start,
@@ -198,20 +751,71 @@ int ishmemi_runtime_pmi::team_split_strided(ishmemi_runtime_team_t parent_team,
                                             const ishmemi_runtime_team_config_t *config,
                                             long config_mask, ishmemi_runtime_team_t *new_team)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    int ret = 0;
+    const team_t &parent = teams[parent_team.pmi];
+    int start = parent.start + PE_start * parent.stride;
+    int stride = parent.stride * PE_stride;
+    int team_rank = ishmemi_pe_in_active_set(teams[world_team].rank, start, stride, PE_size);
+    std::vector<unsigned char> avail(teams.size()), avail_reduced(teams.size());
+    size_t idx = 0;
+
+    new_team->pmi = team_undefined;
+
+    /* Pick the lowest row that is free on every PE of the parent team */
+    for (size_t i = 0; i < teams.size(); i++) {
+        avail[i] = teams[i].in_use ? 0 : 1;
+    }
+    ret = this->uchar_and_reduce(parent_team, avail_reduced.data(), avail.data(), avail.size());
+    ISHMEM_CHECK_GOTO_MSG(ret, fn_exit, "Reduction of the free PMI team rows failed\n");
+
+    while (idx < teams.size() && avail_reduced[idx] == 0)
+        idx++;
+    ISHMEM_CHECK_GOTO_MSG(idx == teams.size(), fn_fail,
+                          "No free PMI team rows (max = %zu), try increasing ISHMEM_TEAMS_MAX\n",
+                          teams.size());
+
+    /* The reduction ended with a sync of the parent, so the members' counters on the row are
+     * final.  The second sync keeps any member from syncing on the new team before the others
+     * have read them */
+    if (team_rank != -1) {
+        team_t &team = teams[idx];
+        team = {start, stride, PE_size, team_rank, 0, std::vector<uint64_t>(PE_size, 0), true};
+        for (int i = 0; i < PE_size; i++) {
+            team.base[i] = __atomic_load_n(shm_counter((int) idx, team_pe(team, i)),
+                                           __ATOMIC_ACQUIRE);
+        }
+        new_team->pmi = (int) idx;
+    }
+    team_sync_impl(parent_team.pmi);
+
+fn_exit:
+    return ret;
+fn_fail:
+    ret = -1;
+    goto fn_exit;
+}
+
+bool ishmemi_runtime_pmi::team_lazy_supported(void)
+{
+    return false;
+}
+
+int ishmemi_runtime_pmi::team_create_lazy(int start, int stride, int size, int team_pe, int tag,
+                                          ishmemi_runtime_team_t *new_team)
+{
     return -1;
 }
 
 void ishmemi_runtime_pmi::team_destroy(ishmemi_runtime_team_t team)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    /* The predefined rows live as long as the runtime */
+    if (team.pmi > self_team && team.pmi < (int) teams.size()) teams[team.pmi] = team_t{};
 }
 
 /* Operation APIs */
 void ishmemi_runtime_pmi::abort(int exit_code, const char msg[])
 {
-    int ret = 0;
+    int ret __attribute__((unused)) = 0;
 
     if (size == 1) {
         fprintf(stderr, "%s\n", msg);
@@ -226,73 +830,225 @@ void ishmemi_runtime_pmi::abort(int exit_code, const char msg[])
 
 int ishmemi_runtime_pmi::get_kvs(int pe, char *key, void *value, size_t valuelen)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    int ret = 0;
+    singleton_kvs_t *entry = nullptr;
+
+    snprintf(this->kvs_key, this->max_key_len, "ishmem-%d-%s", pe, key);
+
+    if (size == 1) {
+        HASH_FIND_STR(this->singleton_kvs, this->kvs_key, entry);
+        ISHMEM_CHECK_GOTO_MSG(entry == nullptr, fn_fail, "KVS key '%s' not found\n", kvs_key);
+        ret = kvs_decode(value, valuelen, entry->val);
+    } else {
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Get(kvs_name, kvs_key, kvs_value,
+                                                              max_val_len));
+        ret = kvs_decode(value, valuelen, kvs_value);
+    }
+
+fn_exit:
+    return ret;
+fn_fail:
+    if (ret == 0) ret = -1;
+    goto fn_exit;
 }
 
 int ishmemi_runtime_pmi::uchar_and_reduce(ishmemi_runtime_team_t team, unsigned char *dest,
                                           const unsigned char *source, size_t nreduce)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    return reduce_impl(team.pmi, dest, source, nreduce,
+                       [](unsigned char a, unsigned char b) { return (unsigned char) (a & b); });
 }
 
 int ishmemi_runtime_pmi::int_max_reduce(ishmemi_runtime_team_t team, int *dest, const int *source,
                                         size_t nreduce)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
-    return -1;
+    return reduce_impl(team.pmi, dest, source, nreduce,
+                       [](int a, int b) { return std::max(a, b); });
 }
 
 void ishmemi_runtime_pmi::bcast(void *buf, size_t count, int root)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    bcast_impl(world_team, buf, buf, count, root);
 }
 
 void ishmemi_runtime_pmi::node_bcast(void *buf, size_t count, int root)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    bcast_impl(world_team, buf, buf, count, root);
 }
 
 void ishmemi_runtime_pmi::fcollect(void *dst, void *src, size_t count)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    fcollect_impl(world_team, dst, src, count);
 }
 
 void ishmemi_runtime_pmi::node_fcollect(void *dst, void *src, size_t count)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    fcollect_impl(world_team, dst, src, count);
 }
 
 void ishmemi_runtime_pmi::barrier_all(void)
 {
-    int ret = 0;
-    PMI_CHECK(ishmemi_pmi_wrappers::Barrier());
+    ishmemi_level_zero_sync();
+    team_sync_impl(world_team);
 }
 
 void ishmemi_runtime_pmi::node_barrier(void)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    team_sync_impl(world_team);
 }
 
 void ishmemi_runtime_pmi::fence(void)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    ishmemi_level_zero_sync();
 }
 
 void ishmemi_runtime_pmi::quiet(void)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    ishmemi_level_zero_sync();
 }
 
 void ishmemi_runtime_pmi::sync(void)
 {
-    RAISE_ERROR_MSG("This API is not yet implemented\n");
+    team_sync_impl(world_team);
 }
 
 void ishmemi_runtime_pmi::progress(void) {}
 
 /* Private functions */
+int ishmemi_runtime_pmi::put_kvs(const char *key, const void *value, size_t valuelen)
+{
+    int ret = 0;
+    singleton_kvs_t *entry = nullptr;
+
+    ISHMEM_CHECK_GOTO_MSG(2 * valuelen + 1 > (size_t) this->max_val_len, fn_fail,
+                          "KVS value for '%s' is too long\n", key);
+    snprintf(this->kvs_key, this->max_key_len, "ishmem-%d-%s", this->rank, key);
+    kvs_encode(this->kvs_value, value, valuelen);
+
+    if (size == 1) {
+        HASH_FIND_STR(this->singleton_kvs, this->kvs_key, entry);
+        if (entry == nullptr) {
+            entry = (singleton_kvs_t *) ::calloc(1, sizeof(singleton_kvs_t));
+            ISHMEM_CHECK_GOTO_MSG(entry == nullptr, fn_fail, "Allocation of KVS entry failed\n");
+            strncpy(entry->key, this->kvs_key, SINGLETON_KEY_LEN - 1);
+            HASH_ADD_STR(this->singleton_kvs, key, entry);
+        }
+        strncpy(entry->val, this->kvs_value, SINGLETON_VAL_LEN - 1);
+    } else {
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Put(kvs_name, kvs_key, kvs_value));
+    }
+
+fn_exit:
+    return ret;
+fn_fail:
+    if (ret == 0) ret = -1;
+    goto fn_exit;
+}
+
+/* Every PE publishes its host through the KVS and PE 0 publishes the name of a POSIX shared-memory
+ * segment, which the other PEs map once they know that the whole job shares the node */
+int ishmemi_runtime_pmi::shm_init(void)
+{
+    int ret = 0;
+    int fd = -1;
+    bool created = false;
+    void *base = MAP_FAILED;
+    char host[HOST_NAME_MAX + 1] = {};
+    char peer_host[HOST_NAME_MAX + 1] = {};
+    char shm_name[NAME_MAX] = {};
+    size_t npes = static_cast<size_t>(this->size);
+
+    shm_slot_size = std::max(ishmemi_params.PMI_SHARED_SLOT_SIZE, shm_line_size);
+    shm_slot_size = (shm_slot_size + shm_line_size - 1) / shm_line_size * shm_line_size;
+    shm_length = teams.size() * npes * shm_line_size + npes * shm_slot_size;
+
+    this->location_array = (int *) ::malloc(sizeof(int) * npes);
+    ISHMEM_CHECK_GOTO_MSG(this->location_array == nullptr, fn_fail,
+                          "Allocation of location_array failed\n");
+
+    /* A singleton has no peers to share the segment with */
+    if (this->size == 1) {
+        this->location_array[0] = 0;
+        this->node_size = 1;
+        shm_base = (uint8_t *) ::calloc(1, shm_length);
+        ISHMEM_CHECK_GOTO_MSG(shm_base == nullptr, fn_fail, "Allocation of shm segment failed\n");
+        goto fn_exit;
+    }
+
+    ret = gethostname(host, HOST_NAME_MAX);
+    ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "gethostname failed\n");
+    ret = this->put_kvs("host", host, strlen(host) + 1);
+    ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+
+    if (this->rank == 0) {
+        snprintf(shm_name, sizeof(shm_name), "/ishmem-pmi-%d", (int) getpid());
+        fd = shm_open(shm_name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        ISHMEM_CHECK_GOTO_MSG(fd < 0, fn_fail, "shm_open of '%s' failed\n", shm_name);
+        created = true;
+        /* A new segment reads as zeroes, so every sync counter starts at 0 */
+        ret = ftruncate(fd, (off_t) shm_length);
+        ISHMEM_CHECK_GOTO_MSG(ret, fn_fail, "ftruncate of '%s' failed\n", shm_name);
+        ret = this->put_kvs("shm", shm_name, strlen(shm_name) + 1);
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+    }
+
+    /* A fence returns every PE's keys at once when the PMI supports it, so the gets below stay
+     * local instead of costing a round trip each */
+    if (ishmemi_pmi_wrappers::kvs_fence_exists) {
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Fence(kvs_name, "ishmem-"));
+    } else {
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::KVS_Commit(kvs_name));
+        PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Barrier());
+    }
+
+    this->node_size = 0;
+    for (int pe = 0; pe < this->size; pe++) {
+        ret = this->get_kvs(pe, (char *) "host", peer_host, sizeof(peer_host));
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+        this->location_array[pe] = (strcmp(peer_host, host) == 0) ? this->node_size++ : -1;
+    }
+
+    /* Every PE reaches the others by load and store through the segment and IPC */
+    ISHMEM_CHECK_GOTO_MSG(this->node_size != this->size, fn_fail,
+                          "The PMI runtime requires all PEs on one node (%d of %d are local)\n",
+                          this->node_size, this->size);
+
+    if (this->rank != 0) {
+        ret = this->get_kvs(0, (char *) "shm", shm_name, sizeof(shm_name) - 1);
+        ISHMEMI_CHECK_RESULT(ret, 0, fn_fail);
+        fd = shm_open(shm_name, O_RDWR, 0);
+        ISHMEM_CHECK_GOTO_MSG(fd < 0, fn_fail, "shm_open of '%s' failed\n", shm_name);
+    }
+
+    base = mmap(nullptr, shm_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ISHMEM_CHECK_GOTO_MSG(base == MAP_FAILED, fn_fail, "mmap of '%s' failed\n", shm_name);
+    shm_base = static_cast<uint8_t *>(base);
+    ::close(fd);
+    fd = -1;
+
+    /* Once every PE has mapped the segment, its name is no longer needed */
+    PMI_CHECK_GOTO(fn_fail, ishmemi_pmi_wrappers::Barrier());
+    if (created) shm_unlink(shm_name);
+
+fn_exit:
+    return ret;
+fn_fail:
+    if (fd >= 0) ::close(fd);
+    if (created) shm_unlink(shm_name);
+    if (ret == 0) ret = -1;
+    goto fn_exit;
+}
+
+void ishmemi_runtime_pmi::shm_fini(void)
+{
+    if (shm_base == nullptr) return;
+
+    if (this->size == 1) ::free(shm_base);
+    else munmap(shm_base, shm_length);
+    shm_base = nullptr;
+    shm_length = 0;
+}
+
 void ishmemi_runtime_pmi::funcptr_init(void)
 {
     proxy_funcs = (ishmemi_runtime_proxy_func_t **) ::malloc(
@@ -300,19 +1056,195 @@ void ishmemi_runtime_pmi::funcptr_init(void)
     ISHMEM_CHECK_GOTO_MSG(proxy_funcs == nullptr, fn_exit, "Allocation of proxy_funcs failed\n");
 
     /* Initialize every function with the "unsupported op" function */
-    /* Don't include KILL operation - it is the same for all backends currently */
-    for (int i = 0; i < ISHMEMI_OP_END - 1; ++i) {
-        for (int j = 0; j < ishmemi_runtime_type::proxy_func_num_types; ++j) {
+    /* Note: KILL operation is covered inside the proxy directly - it is the same for all backends
+     * currently */
+    for (size_t i = 0; i < ISHMEMI_OP_END; ++i) {
+        proxy_funcs[i] = (ishmemi_runtime_proxy_func_t *) ::malloc(
+            sizeof(ishmemi_runtime_proxy_func_t) * ishmemi_runtime_type::proxy_func_num_types);
+        for (size_t j = 0; j < ishmemi_runtime_type::proxy_func_num_types; ++j) {
             proxy_funcs[i][j] = ishmemi_runtime_type::unsupported;
         }
     }
 
+    /* Fill in the supported functions.  Atomics and signal add on other PEs need device-scope
+     * atomics that the host cannot issue through IPC, so those stay unsupported, as do scans and
+     * the wait and test variants over several ivars */
+    /* RMA */
+    proxy_funcs[PUT][UINT8] = impl::put<uint8_t, PUT>;
+    proxy_funcs[P][UINT8] = impl::put<uint8_t, P>;
+    proxy_funcs[P][UINT16] = impl::put<uint16_t, P>;
+    proxy_funcs[P][UINT32] = impl::put<uint32_t, P>;
+    proxy_funcs[P][UINT64] = impl::put<uint64_t, P>;
+    proxy_funcs[P][ULONGLONG] = impl::put<unsigned long long, P>;
+    proxy_funcs[P][FLOAT] = impl::put<float, P>;
+    proxy_funcs[P][DOUBLE] = impl::put<double, P>;
+    proxy_funcs[PUT_NBI][UINT8] = impl::put<uint8_t, PUT, false>;
+
+    proxy_funcs[GET][UINT8] = impl::get<uint8_t, GET>;
+    proxy_funcs[G][UINT8] = impl::get<uint8_t, G>;
+    proxy_funcs[G][UINT16] = impl::get<uint16_t, G>;
+    proxy_funcs[G][UINT32] = impl::get<uint32_t, G>;
+    proxy_funcs[G][UINT64] = impl::get<uint64_t, G>;
+    proxy_funcs[G][ULONGLONG] = impl::get<unsigned long long, G>;
+    proxy_funcs[G][FLOAT] = impl::get<float, G>;
+    proxy_funcs[G][DOUBLE] = impl::get<double, G>;
+    proxy_funcs[GET_NBI][UINT8] = impl::get<uint8_t, GET, false>;
+
+    proxy_funcs[IPUT][UINT8] = impl::iput<uint8_t, IPUT>;
+    proxy_funcs[IPUT][UINT16] = impl::iput<uint16_t, IPUT>;
+    proxy_funcs[IPUT][UINT32] = impl::iput<uint32_t, IPUT>;
+    proxy_funcs[IPUT][UINT64] = impl::iput<uint64_t, IPUT>;
+    proxy_funcs[IPUT][ULONGLONG] = impl::iput<unsigned long long, IPUT>;
+    proxy_funcs[IBPUT][UINT8] = impl::iput<uint8_t, IBPUT>;
+    proxy_funcs[IBPUT][UINT16] = impl::iput<uint16_t, IBPUT>;
+    proxy_funcs[IBPUT][UINT32] = impl::iput<uint32_t, IBPUT>;
+    proxy_funcs[IBPUT][UINT64] = impl::iput<uint64_t, IBPUT>;
+    proxy_funcs[IBPUT][ULONGLONG] = impl::iput<unsigned long long, IBPUT>;
+
+    proxy_funcs[IGET][UINT8] = impl::iget<uint8_t, IGET>;
+    proxy_funcs[IGET][UINT16] = impl::iget<uint16_t, IGET>;
+    proxy_funcs[IGET][UINT32] = impl::iget<uint32_t, IGET>;
+    proxy_funcs[IGET][UINT64] = impl::iget<uint64_t, IGET>;
+    proxy_funcs[IGET][ULONGLONG] = impl::iget<unsigned long long, IGET>;
+    proxy_funcs[IBGET][UINT8] = impl::iget<uint8_t, IBGET>;
+    proxy_funcs[IBGET][UINT16] = impl::iget<uint16_t, IBGET>;
+    proxy_funcs[IBGET][UINT32] = impl::iget<uint32_t, IBGET>;
+    proxy_funcs[IBGET][UINT64] = impl::iget<uint64_t, IBGET>;
+    proxy_funcs[IBGET][ULONGLONG] = impl::iget<unsigned long long, IBGET>;
+
+    /* Signaling */
+    proxy_funcs[PUT_SIGNAL][UINT8] = impl::put_signal;
+    proxy_funcs[PUT_SIGNAL_NBI][UINT8] = impl::put_signal;
+    proxy_funcs[SIGNAL_FETCH][0] = impl::signal_fetch;
+    proxy_funcs[SIGNAL_SET][UINT64] = impl::signal_set;
+    proxy_funcs[SIGNAL_WAIT_UNTIL][UINT64] = impl::signal_wait_until;
+
+    /* Memory ordering */
+    proxy_funcs[FENCE][0] = impl::fence;
+    proxy_funcs[QUIET][0] = impl::quiet;
+
+    /* Teams */
+    proxy_funcs[TEAM_MY_PE][0] = impl::team_my_pe;
+    proxy_funcs[TEAM_N_PES][0] = impl::team_n_pes;
+    proxy_funcs[TEAM_SYNC][0] = impl::sync<TEAM_SYNC>;
+
+    /* Collectives */
+    proxy_funcs[BARRIER][0] = impl::barrier;
+    proxy_funcs[SYNC][0] = impl::sync<SYNC>;
+    proxy_funcs[ALLTOALL][UINT8] = impl::alltoall;
+    proxy_funcs[BCAST][UINT8] = impl::broadcast;
+    proxy_funcs[COLLECT][UINT8] = impl::collect;
+    proxy_funcs[FCOLLECT][UINT8] = impl::fcollect;
+
+    /* Reductions */
+    proxy_funcs[AND_REDUCE][UINT8] = impl::reduce<uint8_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][UINT8] = impl::reduce<uint8_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][UINT8] = impl::reduce<uint8_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][UINT8] = impl::reduce<uint8_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][UINT8] = impl::reduce<uint8_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][UINT8] = impl::reduce<uint8_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][UINT8] = impl::reduce<uint8_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][UINT16] = impl::reduce<uint16_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][UINT16] = impl::reduce<uint16_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][UINT16] = impl::reduce<uint16_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][UINT16] = impl::reduce<uint16_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][UINT16] = impl::reduce<uint16_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][UINT16] = impl::reduce<uint16_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][UINT16] = impl::reduce<uint16_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][UINT32] = impl::reduce<uint32_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][UINT32] = impl::reduce<uint32_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][UINT32] = impl::reduce<uint32_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][UINT32] = impl::reduce<uint32_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][UINT32] = impl::reduce<uint32_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][UINT32] = impl::reduce<uint32_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][UINT32] = impl::reduce<uint32_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][UINT64] = impl::reduce<uint64_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][UINT64] = impl::reduce<uint64_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][UINT64] = impl::reduce<uint64_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][UINT64] = impl::reduce<uint64_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][UINT64] = impl::reduce<uint64_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][UINT64] = impl::reduce<uint64_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][UINT64] = impl::reduce<uint64_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][ULONGLONG] = impl::reduce<unsigned long long, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][INT8] = impl::reduce<int8_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][INT8] = impl::reduce<int8_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][INT8] = impl::reduce<int8_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][INT8] = impl::reduce<int8_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][INT8] = impl::reduce<int8_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][INT8] = impl::reduce<int8_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][INT8] = impl::reduce<int8_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][INT16] = impl::reduce<int16_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][INT16] = impl::reduce<int16_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][INT16] = impl::reduce<int16_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][INT16] = impl::reduce<int16_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][INT16] = impl::reduce<int16_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][INT16] = impl::reduce<int16_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][INT16] = impl::reduce<int16_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][INT32] = impl::reduce<int32_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][INT32] = impl::reduce<int32_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][INT32] = impl::reduce<int32_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][INT32] = impl::reduce<int32_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][INT32] = impl::reduce<int32_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][INT32] = impl::reduce<int32_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][INT32] = impl::reduce<int32_t, PROD_REDUCE>;
+
+    proxy_funcs[AND_REDUCE][INT64] = impl::reduce<int64_t, AND_REDUCE>;
+    proxy_funcs[OR_REDUCE][INT64] = impl::reduce<int64_t, OR_REDUCE>;
+    proxy_funcs[XOR_REDUCE][INT64] = impl::reduce<int64_t, XOR_REDUCE>;
+    proxy_funcs[MAX_REDUCE][INT64] = impl::reduce<int64_t, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][INT64] = impl::reduce<int64_t, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][INT64] = impl::reduce<int64_t, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][INT64] = impl::reduce<int64_t, PROD_REDUCE>;
+
+    proxy_funcs[MAX_REDUCE][LONGLONG] = impl::reduce<long long, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][LONGLONG] = impl::reduce<long long, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][LONGLONG] = impl::reduce<long long, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][LONGLONG] = impl::reduce<long long, PROD_REDUCE>;
+
+    proxy_funcs[MAX_REDUCE][FLOAT] = impl::reduce<float, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][FLOAT] = impl::reduce<float, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][FLOAT] = impl::reduce<float, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][FLOAT] = impl::reduce<float, PROD_REDUCE>;
+
+    proxy_funcs[MAX_REDUCE][DOUBLE] = impl::reduce<double, MAX_REDUCE>;
+    proxy_funcs[MIN_REDUCE][DOUBLE] = impl::reduce<double, MIN_REDUCE>;
+    proxy_funcs[SUM_REDUCE][DOUBLE] = impl::reduce<double, SUM_REDUCE>;
+    proxy_funcs[PROD_REDUCE][DOUBLE] = impl::reduce<double, PROD_REDUCE>;
+
+    /* Point-to-point Synchronization */
+    proxy_funcs[TEST][INT32] = impl::test<int32_t, TEST>;
+    proxy_funcs[WAIT][INT32] = impl::wait_until<int32_t, WAIT>;
+    proxy_funcs[TEST][INT64] = impl::test<int64_t, TEST>;
+    proxy_funcs[WAIT][INT64] = impl::wait_until<int64_t, WAIT>;
+    proxy_funcs[TEST][LONGLONG] = impl::test<long long, TEST>;
+    proxy_funcs[WAIT][LONGLONG] = impl::wait_until<long long, WAIT>;
+    proxy_funcs[TEST][UINT32] = impl::test<uint32_t, TEST>;
+    proxy_funcs[WAIT][UINT32] = impl::wait_until<uint32_t, WAIT>;
+    proxy_funcs[TEST][UINT64] = impl::test<uint64_t, TEST>;
+    proxy_funcs[WAIT][UINT64] = impl::wait_until<uint64_t, WAIT>;
+    proxy_funcs[TEST][ULONGLONG] = impl::test<unsigned long long, TEST>;
+    proxy_funcs[WAIT][ULONGLONG] = impl::wait_until<unsigned long long, WAIT>;
+
 fn_exit:
     return;
 }
 
 void ishmemi_runtime_pmi::funcptr_fini(void)
 {
+    if (proxy_funcs == nullptr) return;
     for (int i = 0; i < ISHMEMI_OP_END; ++i) {
         for (int j = 0; j < ishmemi_runtime_type::proxy_func_num_types; ++j) {
             proxy_funcs[i][j] = &ishmemi_runtime_type::unsupported;
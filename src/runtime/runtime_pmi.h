@@ -5,12 +5,14 @@
 #ifndef ISHMEM_RUNTIME_PMI_H
 #define ISHMEM_RUNTIME_PMI_H
 
-/* Wrappers to interface with MPI runtime */
+/* Wrappers to interface with PMI runtime */
 #include "ishmem/config.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <mutex>
+#include <vector>
 
 #include "runtime.h"
 #include "wrapper.h"
@@ -36,6 +38,7 @@ class ishmemi_runtime_pmi : public ishmemi_runtime_type {
     void *malloc(size_t) override;
     void *calloc(size_t, size_t) override;
     void free(void *) override;
+    bool malloc_is_symmetric(void) override;
 
     /* Team APIs */
     int team_sync(ishmemi_runtime_team_t) override;
@@ -44,6 +47,8 @@ class ishmemi_runtime_pmi : public ishmemi_runtime_type {
     int team_split_strided(ishmemi_runtime_team_t, int, int, int,
                            const ishmemi_runtime_team_config_t *, long,
                            ishmemi_runtime_team_t *) override;
+    bool team_lazy_supported(void) override;
+    int team_create_lazy(int, int, int, int, int, ishmemi_runtime_team_t *) override;
     void team_destroy(ishmemi_runtime_team_t) override;
 
     /* Operation APIs */
@@ -64,10 +69,29 @@ class ishmemi_runtime_pmi : public ishmemi_runtime_type {
 
     void progress(void) override;
 
+    /* Team bookkeeping for the shared-memory synchronization */
+    typedef struct team_t {
+        int start = 0;
+        int stride = 1;
+        int size = 0;
+        int rank = -1;
+        /* Syncs this PE has entered on the team, updated atomically as the proxy and host threads
+         * may both sync */
+        uint64_t epoch = 0;
+        /* Each member's sync counter on the team's row when the team was created */
+        std::vector<uint64_t> base;
+        bool in_use = false;
+    } team_t;
+
   private:
     void funcptr_init(void);
     void funcptr_fini(void);
 
+    /* Bootstrap helpers over the PMI KVS (or the local KVS for singleton runs) */
+    int put_kvs(const char *, const void *, size_t);
+    int shm_init(void);
+    void shm_fini(void);
+
     int rank = -1;
     int size = 0;
     int node_size = 0;
@@ -89,6 +113,27 @@ class ishmemi_runtime_pmi : public ishmemi_runtime_type {
     } singleton_kvs_t;
 
     singleton_kvs_t *singleton_kvs = nullptr;
+
+  public:
+    /* Variables that are needed outside of class methods */
+    static constexpr ishmemi_runtime_pmi_types::team_t team_undefined = -1;
+    static constexpr ishmemi_runtime_pmi_types::team_t world_team = 0;
+    static constexpr ishmemi_runtime_pmi_types::team_t self_team = 1;
+    static std::vector<team_t> teams;
+
+    static void *heap_base;
+    static size_t heap_length;
+
+    /* POSIX shared-memory segment mapped by every PE.  It starts with a sync counter per team row
+     * and PE, each on its own cache line, followed by a staging slot of shm_slot_size bytes per PE
+     * for the host-side collectives */
+    static constexpr size_t shm_line_size = 64;
+    static uint8_t *shm_base;
+    static size_t shm_length;
+    static size_t shm_slot_size;
+    /* Serializes the collectives that stage data in this PE's slot, which the proxy and host
+     * threads share */
+    static std::mutex coll_mtx;
 };
 
-#endif /* ISHMEM_RUNTIME_MPI_H */
+#endif /* ISHMEM_RUNTIME_PMI_H */
@@ -23,7 +23,7 @@
 
 #if defined(ENABLE_PMI)
 #include "runtime_pmi_types.h"
-#define PMI_CLASS(TYPE) ishmemi_runtime_pmi_types::##TYPE pmi
+#define PMI_CLASS(TYPE) ishmemi_runtime_pmi_types::TYPE pmi
 #else
 #define PMI_CLASS(TYPE)
 #endif
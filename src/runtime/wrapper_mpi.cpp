@@ -24,8 +24,10 @@ namespace ishmemi_mpi_wrappers {
     int (*Comm_split_type)(MPI_Comm, int, int, MPI_Info, MPI_Comm *);
     int (*Comm_dup)(MPI_Comm, MPI_Comm *);
     int (*Comm_free)(MPI_Comm *);
+    int (*Comm_create_group)(MPI_Comm, MPI_Group, int, MPI_Comm *);
     int (*Group_translate_ranks)(MPI_Group, int, const int[], MPI_Group, int[]);
     int (*Group_free)(MPI_Group *);
+    int (*Group_range_incl)(MPI_Group, int, int[][3], MPI_Group *);
 
     /* Info hints */
     int (*Info_create)(MPI_Info *);
@@ -34,10 +36,13 @@ namespace ishmemi_mpi_wrappers {
 
     /* Window management */
     int (*Win_create)(void *, MPI_Aint, int, MPI_Info, MPI_Comm, MPI_Win *);
+    int (*Win_allocate_shared)(MPI_Aint, int, MPI_Info, MPI_Comm, void *, MPI_Win *);
+    int (*Win_shared_query)(MPI_Win, int, MPI_Aint *, int *, void *);
     int (*Win_lock_all)(int, MPI_Win);
     int (*Win_unlock_all)(MPI_Win);
     int (*Win_lock)(int, int, int, MPI_Win);
     int (*Win_unlock)(int, MPI_Win);
+    int (*Win_flush)(int, MPI_Win);
     int (*Win_flush_local)(int, MPI_Win);
     int (*Win_flush_local_all)(MPI_Win);
     int (*Win_flush_all)(MPI_Win);
@@ -47,6 +52,7 @@ namespace ishmemi_mpi_wrappers {
     /* Datatypes */
     int (*Type_vector)(int, int, int, MPI_Datatype, MPI_Datatype *);
     int (*Type_create_resized)(MPI_Datatype, MPI_Aint, MPI_Aint, MPI_Datatype *);
+    int (*Type_get_extent)(MPI_Datatype, MPI_Aint *, MPI_Aint *);
     int (*Type_commit)(MPI_Datatype *);
     int (*Type_free)(MPI_Datatype *);
 
@@ -55,11 +61,23 @@ namespace ishmemi_mpi_wrappers {
     int (*Get)(void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win);
     int (*Accumulate)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Op,
                       MPI_Win);
+    int (*Get_accumulate)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, int, MPI_Aint,
+                          int, MPI_Datatype, MPI_Op, MPI_Win);
     int (*Fetch_and_op)(const void *, void *, MPI_Datatype, int, MPI_Aint, MPI_Op, MPI_Win);
     int (*Compare_and_swap)(const void *, const void *, void *, MPI_Datatype, int, MPI_Aint,
                             MPI_Win);
     int (*Iprobe)(int, int, MPI_Comm, int *, MPI_Status *);
 
+    /* Request-based RMA */
+    int (*Rput)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win,
+                MPI_Request *);
+    int (*Rget)(void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win,
+                MPI_Request *);
+    int (*Raccumulate)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Op,
+                       MPI_Win, MPI_Request *);
+    int (*Rget_accumulate)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, int,
+                           MPI_Aint, int, MPI_Datatype, MPI_Op, MPI_Win, MPI_Request *);
+
     /* Collectives */
     int (*Allgather)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm);
     int (*Allgatherv)(const void *, int, MPI_Datatype, void *, const int[], const int[],
@@ -68,9 +86,23 @@ namespace ishmemi_mpi_wrappers {
     int (*Scan)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm);
     int (*Exscan)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm);
     int (*Alltoall)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm);
+    int (*Alltoallv)(const void *, const int[], const int[], MPI_Datatype, void *, const int[],
+                     const int[], MPI_Datatype, MPI_Comm);
     int (*Barrier)(MPI_Comm);
     int (*Bcast)(void *, int, MPI_Datatype, int, MPI_Comm);
 
+    /* Nonblocking collectives */
+    int (*Iallgather)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm,
+                      MPI_Request *);
+    int (*Iallreduce)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm, MPI_Request *);
+    int (*Ialltoall)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm,
+                     MPI_Request *);
+    int (*Ibcast)(void *, int, MPI_Datatype, int, MPI_Comm, MPI_Request *);
+    int (*Test)(MPI_Request *, int *, MPI_Status *);
+    int (*Testsome)(int, MPI_Request[], int *, int[], MPI_Status[]);
+    int (*Wait)(MPI_Request *, MPI_Status *);
+    int (*Waitall)(int, MPI_Request[], MPI_Status[]);
+
     /* dl handle */
     void *mpi_handle = nullptr;
     std::vector<void **> wrapper_list;
@@ -118,8 +150,10 @@ namespace ishmemi_mpi_wrappers {
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Comm_split_type);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Comm_dup);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Comm_free);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Comm_create_group);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Group_translate_ranks);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Group_free);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Group_range_incl);
 
         /* Info hints */
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Info_create);
@@ -128,10 +162,13 @@ namespace ishmemi_mpi_wrappers {
 
         /* Window Management */
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_create);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_allocate_shared);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_shared_query);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_lock_all);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_unlock_all);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_lock);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_unlock);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_flush);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_flush_local);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_flush_local_all);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Win_flush_all);
@@ -141,6 +178,7 @@ namespace ishmemi_mpi_wrappers {
         /* Datatypes */
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Type_vector);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Type_create_resized);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Type_get_extent);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Type_commit);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Type_free);
 
@@ -148,10 +186,17 @@ namespace ishmemi_mpi_wrappers {
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Put);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Get);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Accumulate);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Get_accumulate);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Fetch_and_op);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Compare_and_swap);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Iprobe);
 
+        /* Request-based RMA */
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Rput);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Rget);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Raccumulate);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Rget_accumulate);
+
         /* Collectives */
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Allgather);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Allgatherv);
@@ -159,9 +204,20 @@ namespace ishmemi_mpi_wrappers {
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Scan);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Exscan);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Alltoall);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Alltoallv);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Barrier);
         ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Bcast);
 
+        /* Nonblocking collectives */
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Iallgather);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Iallreduce);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Ialltoall);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Ibcast);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Test);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Testsome);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Wait);
+        ISHMEMI_LINK_SYMBOL(mpi_handle, MPI, Waitall);
+
     fn_exit:
         return ret;
     }
@@ -23,8 +23,10 @@ namespace ishmemi_mpi_wrappers {
     extern int (*Comm_split_type)(MPI_Comm, int, int, MPI_Info, MPI_Comm *);
     extern int (*Comm_dup)(MPI_Comm, MPI_Comm *);
     extern int (*Comm_free)(MPI_Comm *);
+    extern int (*Comm_create_group)(MPI_Comm, MPI_Group, int, MPI_Comm *);
     extern int (*Group_translate_ranks)(MPI_Group, int, const int[], MPI_Group, int[]);
     extern int (*Group_free)(MPI_Group *);
+    extern int (*Group_range_incl)(MPI_Group, int, int[][3], MPI_Group *);
 
     /* Info hints */
     extern int (*Info_create)(MPI_Info *);
@@ -33,10 +35,13 @@ namespace ishmemi_mpi_wrappers {
 
     /* Window management */
     extern int (*Win_create)(void *, MPI_Aint, int, MPI_Info, MPI_Comm, MPI_Win *);
+    extern int (*Win_allocate_shared)(MPI_Aint, int, MPI_Info, MPI_Comm, void *, MPI_Win *);
+    extern int (*Win_shared_query)(MPI_Win, int, MPI_Aint *, int *, void *);
     extern int (*Win_lock_all)(int, MPI_Win);
     extern int (*Win_unlock_all)(MPI_Win);
     extern int (*Win_lock)(int, int, int, MPI_Win);
     extern int (*Win_unlock)(int, MPI_Win);
+    extern int (*Win_flush)(int, MPI_Win);
     extern int (*Win_flush_local)(int, MPI_Win);
     extern int (*Win_flush_local_all)(MPI_Win);
     extern int (*Win_flush_all)(MPI_Win);
@@ -46,6 +51,7 @@ namespace ishmemi_mpi_wrappers {
     /* Datatypes */
     extern int (*Type_vector)(int, int, int, MPI_Datatype, MPI_Datatype *);
     extern int (*Type_create_resized)(MPI_Datatype, MPI_Aint, MPI_Aint, MPI_Datatype *);
+    extern int (*Type_get_extent)(MPI_Datatype, MPI_Aint *, MPI_Aint *);
     extern int (*Type_commit)(MPI_Datatype *);
     extern int (*Type_free)(MPI_Datatype *);
 
@@ -54,11 +60,23 @@ namespace ishmemi_mpi_wrappers {
     extern int (*Get)(void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win);
     extern int (*Accumulate)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype,
                              MPI_Op, MPI_Win);
+    extern int (*Get_accumulate)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, int,
+                                 MPI_Aint, int, MPI_Datatype, MPI_Op, MPI_Win);
     extern int (*Fetch_and_op)(const void *, void *, MPI_Datatype, int, MPI_Aint, MPI_Op, MPI_Win);
     extern int (*Compare_and_swap)(const void *, const void *, void *, MPI_Datatype, int, MPI_Aint,
                                    MPI_Win);
     extern int (*Iprobe)(int, int, MPI_Comm, int *, MPI_Status *);
 
+    /* Request-based RMA */
+    extern int (*Rput)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win,
+                       MPI_Request *);
+    extern int (*Rget)(void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype, MPI_Win,
+                       MPI_Request *);
+    extern int (*Raccumulate)(const void *, int, MPI_Datatype, int, MPI_Aint, int, MPI_Datatype,
+                              MPI_Op, MPI_Win, MPI_Request *);
+    extern int (*Rget_accumulate)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, int,
+                                  MPI_Aint, int, MPI_Datatype, MPI_Op, MPI_Win, MPI_Request *);
+
     /* Collectives */
     extern int (*Allgather)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm);
     extern int (*Allgatherv)(const void *, int, MPI_Datatype, void *, const int[], const int[],
@@ -67,8 +85,23 @@ namespace ishmemi_mpi_wrappers {
     extern int (*Scan)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm);
     extern int (*Exscan)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm);
     extern int (*Alltoall)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm);
+    extern int (*Alltoallv)(const void *, const int[], const int[], MPI_Datatype, void *,
+                            const int[], const int[], MPI_Datatype, MPI_Comm);
     extern int (*Barrier)(MPI_Comm);
     extern int (*Bcast)(void *, int, MPI_Datatype, int, MPI_Comm);
+
+    /* Nonblocking collectives */
+    extern int (*Iallgather)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm,
+                             MPI_Request *);
+    extern int (*Iallreduce)(const void *, void *, int, MPI_Datatype, MPI_Op, MPI_Comm,
+                             MPI_Request *);
+    extern int (*Ialltoall)(const void *, int, MPI_Datatype, void *, int, MPI_Datatype, MPI_Comm,
+                            MPI_Request *);
+    extern int (*Ibcast)(void *, int, MPI_Datatype, int, MPI_Comm, MPI_Request *);
+    extern int (*Test)(MPI_Request *, int *, MPI_Status *);
+    extern int (*Testsome)(int, MPI_Request[], int *, int[], MPI_Status[]);
+    extern int (*Wait)(MPI_Request *, MPI_Status *);
+    extern int (*Waitall)(int, MPI_Request[], MPI_Status[]);
 }  // namespace ishmemi_mpi_wrappers
 
 #endif
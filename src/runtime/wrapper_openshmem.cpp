@@ -248,6 +248,10 @@ namespace ishmemi_openshmem_wrappers {
     int (*uint8_broadcast)(shmem_team_t, uint8_t *, const uint8_t *, size_t, int);
     int (*uint8_collect)(shmem_team_t, uint8_t *, const uint8_t *, size_t);
     int (*uint8_fcollect)(shmem_team_t, uint8_t *, const uint8_t *, size_t);
+    alltoalls_type<uint8_t> uint8_alltoalls;
+    alltoalls_type<uint16_t> uint16_alltoalls;
+    alltoalls_type<uint32_t> uint32_alltoalls;
+    alltoalls_type<uint64_t> uint64_alltoalls;
 
     /* Reductions */
     reduce_type<unsigned char> uchar_and_reduce;
@@ -466,6 +470,45 @@ namespace ishmemi_openshmem_wrappers {
     void (*fence)(void);
     void (*quiet)(void);
 
+    /* Contexts */
+    bool ctx_exists;
+    int (*ctx_create)(long, shmem_ctx_t *);
+    void (*ctx_destroy)(shmem_ctx_t);
+    void (*ctx_fence)(shmem_ctx_t);
+    void (*ctx_quiet)(shmem_ctx_t);
+    ctx_rma_type<uint8_t> ctx_uint8_put;
+    ctx_rma_type<uint8_t> ctx_uint8_put_nbi;
+    ctx_rma_type<uint8_t> ctx_uint8_get;
+    ctx_rma_type<uint8_t> ctx_uint8_get_nbi;
+    ctx_irma_type<uint8_t> ctx_uint8_iput;
+    ctx_irma_type<uint16_t> ctx_uint16_iput;
+    ctx_irma_type<uint32_t> ctx_uint32_iput;
+    ctx_irma_type<uint64_t> ctx_uint64_iput;
+    ctx_irma_type<unsigned long long> ctx_ulonglong_iput;
+    ctx_irma_type<uint8_t> ctx_uint8_iget;
+    ctx_irma_type<uint16_t> ctx_uint16_iget;
+    ctx_irma_type<uint32_t> ctx_uint32_iget;
+    ctx_irma_type<uint64_t> ctx_uint64_iget;
+    ctx_irma_type<unsigned long long> ctx_ulonglong_iget;
+    ctx_p_type<uint8_t> ctx_uint8_p;
+    ctx_p_type<uint16_t> ctx_uint16_p;
+    ctx_p_type<uint32_t> ctx_uint32_p;
+    ctx_p_type<uint64_t> ctx_uint64_p;
+    ctx_p_type<unsigned long long> ctx_ulonglong_p;
+    ctx_p_type<float> ctx_float_p;
+    ctx_p_type<double> ctx_double_p;
+    ctx_g_type<uint8_t> ctx_uint8_g;
+    ctx_g_type<uint16_t> ctx_uint16_g;
+    ctx_g_type<uint32_t> ctx_uint32_g;
+    ctx_g_type<uint64_t> ctx_uint64_g;
+    ctx_g_type<unsigned long long> ctx_ulonglong_g;
+    ctx_g_type<float> ctx_float_g;
+    ctx_g_type<double> ctx_double_g;
+    void (*ctx_uint8_put_signal)(shmem_ctx_t, uint8_t *, const uint8_t *, size_t, uint64_t *,
+                                 uint64_t, int, int);
+    void (*ctx_uint8_put_signal_nbi)(shmem_ctx_t, uint8_t *, const uint8_t *, size_t, uint64_t *,
+                                     uint64_t, int, int);
+
     /* dl handle */
     void *shmem_handle = nullptr;
     std::vector<void **> wrapper_list;
@@ -734,6 +777,10 @@ namespace ishmemi_openshmem_wrappers {
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint8_broadcast);
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint8_collect);
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint8_fcollect);
+        ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint8_alltoalls);
+        ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint16_alltoalls);
+        ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint32_alltoalls);
+        ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uint64_alltoalls);
 
         /* Reductions */
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, uchar_and_reduce);
@@ -951,6 +998,43 @@ namespace ishmemi_openshmem_wrappers {
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, fence);
         ISHMEMI_LINK_SYMBOL(shmem_handle, shmem, quiet);
 
+        /* Contexts are optional; the runtime issues on the default context without them */
+        ctx_exists = true;
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_create, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_destroy, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_fence, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_quiet, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_put, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_put_nbi, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_get, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_get_nbi, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_iput, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint16_iput, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint32_iput, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint64_iput, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_ulonglong_iput, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_iget, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint16_iget, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint32_iget, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint64_iget, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_ulonglong_iget, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint16_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint32_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint64_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_ulonglong_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_float_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_double_p, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint16_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint32_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint64_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_ulonglong_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_float_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_double_g, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_put_signal, ctx_exists);
+        ISHMEMI_TRY_LINK_SYMBOL(shmem_handle, shmem, ctx_uint8_put_signal_nbi, ctx_exists);
+
     fn_exit:
         return ret;
     }
@@ -37,6 +37,12 @@ namespace ishmemi_openshmem_wrappers {
     template <typename T> using p_type = void (*)(T *, T, int);
     template <typename T> using g_type = T (*)(const T *, int);
 
+    /* Context RMA */
+    template <typename T> using ctx_rma_type = void (*)(shmem_ctx_t, T *, const T *, size_t, int);
+    template <typename T> using ctx_irma_type = void (*)(shmem_ctx_t, T *, const T *, ptrdiff_t, ptrdiff_t, size_t, int);
+    template <typename T> using ctx_p_type = void (*)(shmem_ctx_t, T *, T, int);
+    template <typename T> using ctx_g_type = T (*)(shmem_ctx_t, const T *, int);
+
     /* Non-blocking AMO */
     template <typename T> using atomic_fetch_nbi_type = void (*)(T *, const T *, int);
     template <typename T> using atomic_fetch_inc_nbi_type = void (*)(T *, T *, int);
@@ -54,6 +60,9 @@ namespace ishmemi_openshmem_wrappers {
     template <typename T> using atomic_inc_type = void (*)(T *, int);
     template <typename T> using atomic_op_type = void (*)(T *, T, int);
 
+    /* Collectives */
+    template <typename T> using alltoalls_type = int (*)(shmem_team_t, T *, const T *, ptrdiff_t, ptrdiff_t, size_t);
+
     /* Reductions */
     template <typename T> using reduce_type = int (*)(shmem_team_t, T *, const T *, size_t);
 
@@ -306,6 +315,10 @@ namespace ishmemi_openshmem_wrappers {
     extern int (*uint8_broadcast)(shmem_team_t, uint8_t *, const uint8_t *, size_t, int);
     extern int (*uint8_collect)(shmem_team_t, uint8_t *, const uint8_t *, size_t);
     extern int (*uint8_fcollect)(shmem_team_t, uint8_t *, const uint8_t *, size_t);
+    extern alltoalls_type<uint8_t> uint8_alltoalls;
+    extern alltoalls_type<uint16_t> uint16_alltoalls;
+    extern alltoalls_type<uint32_t> uint32_alltoalls;
+    extern alltoalls_type<uint64_t> uint64_alltoalls;
 
     /* Reductions */
     extern reduce_type<unsigned char> uchar_and_reduce;
@@ -525,9 +538,80 @@ namespace ishmemi_openshmem_wrappers {
     extern void (*fence)(void);
     extern void (*quiet)(void);
 
+    /* Contexts */
+    extern bool ctx_exists;
+    extern int (*ctx_create)(long, shmem_ctx_t *);
+    extern void (*ctx_destroy)(shmem_ctx_t);
+    extern void (*ctx_fence)(shmem_ctx_t);
+    extern void (*ctx_quiet)(shmem_ctx_t);
+    extern ctx_rma_type<uint8_t> ctx_uint8_put;
+    extern ctx_rma_type<uint8_t> ctx_uint8_put_nbi;
+    extern ctx_rma_type<uint8_t> ctx_uint8_get;
+    extern ctx_rma_type<uint8_t> ctx_uint8_get_nbi;
+    extern ctx_irma_type<uint8_t> ctx_uint8_iput;
+    extern ctx_irma_type<uint16_t> ctx_uint16_iput;
+    extern ctx_irma_type<uint32_t> ctx_uint32_iput;
+    extern ctx_irma_type<uint64_t> ctx_uint64_iput;
+    extern ctx_irma_type<unsigned long long> ctx_ulonglong_iput;
+    extern ctx_irma_type<uint8_t> ctx_uint8_iget;
+    extern ctx_irma_type<uint16_t> ctx_uint16_iget;
+    extern ctx_irma_type<uint32_t> ctx_uint32_iget;
+    extern ctx_irma_type<uint64_t> ctx_uint64_iget;
+    extern ctx_irma_type<unsigned long long> ctx_ulonglong_iget;
+    extern ctx_p_type<uint8_t> ctx_uint8_p;
+    extern ctx_p_type<uint16_t> ctx_uint16_p;
+    extern ctx_p_type<uint32_t> ctx_uint32_p;
+    extern ctx_p_type<uint64_t> ctx_uint64_p;
+    extern ctx_p_type<unsigned long long> ctx_ulonglong_p;
+    extern ctx_p_type<float> ctx_float_p;
+    extern ctx_p_type<double> ctx_double_p;
+    extern ctx_g_type<uint8_t> ctx_uint8_g;
+    extern ctx_g_type<uint16_t> ctx_uint16_g;
+    extern ctx_g_type<uint32_t> ctx_uint32_g;
+    extern ctx_g_type<uint64_t> ctx_uint64_g;
+    extern ctx_g_type<unsigned long long> ctx_ulonglong_g;
+    extern ctx_g_type<float> ctx_float_g;
+    extern ctx_g_type<double> ctx_double_g;
+    extern void (*ctx_uint8_put_signal)(shmem_ctx_t, uint8_t *, const uint8_t *, size_t, uint64_t *,
+                                        uint64_t, int, int);
+    extern void (*ctx_uint8_put_signal_nbi)(shmem_ctx_t, uint8_t *, const uint8_t *, size_t,
+                                            uint64_t *, uint64_t, int, int);
+
     /* Define the template specializations for each shmem wrapper function which has more than one
      * supported type */
     /* clang-format off */
+    template <typename T> static constexpr ctx_irma_type<T> ctx_iput() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
+    template <> inline auto ctx_iput<uint8_t>() -> ctx_irma_type<uint8_t> { return ctx_uint8_iput; }
+    template <> inline auto ctx_iput<uint16_t>() -> ctx_irma_type<uint16_t> { return ctx_uint16_iput; }
+    template <> inline auto ctx_iput<uint32_t>() -> ctx_irma_type<uint32_t> { return ctx_uint32_iput; }
+    template <> inline auto ctx_iput<uint64_t>() -> ctx_irma_type<uint64_t> { return ctx_uint64_iput; }
+    template <> inline auto ctx_iput<unsigned long long>() -> ctx_irma_type<unsigned long long> { return ctx_ulonglong_iput; }
+
+    template <typename T> static constexpr ctx_irma_type<T> ctx_iget() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
+    template <> inline auto ctx_iget<uint8_t>() -> ctx_irma_type<uint8_t> { return ctx_uint8_iget; }
+    template <> inline auto ctx_iget<uint16_t>() -> ctx_irma_type<uint16_t> { return ctx_uint16_iget; }
+    template <> inline auto ctx_iget<uint32_t>() -> ctx_irma_type<uint32_t> { return ctx_uint32_iget; }
+    template <> inline auto ctx_iget<uint64_t>() -> ctx_irma_type<uint64_t> { return ctx_uint64_iget; }
+    template <> inline auto ctx_iget<unsigned long long>() -> ctx_irma_type<unsigned long long> { return ctx_ulonglong_iget; }
+
+    template <typename T> static constexpr ctx_p_type<T> ctx_p() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
+    template <> inline auto ctx_p<uint8_t>() -> ctx_p_type<uint8_t> { return ctx_uint8_p; }
+    template <> inline auto ctx_p<uint16_t>() -> ctx_p_type<uint16_t> { return ctx_uint16_p; }
+    template <> inline auto ctx_p<uint32_t>() -> ctx_p_type<uint32_t> { return ctx_uint32_p; }
+    template <> inline auto ctx_p<uint64_t>() -> ctx_p_type<uint64_t> { return ctx_uint64_p; }
+    template <> inline auto ctx_p<unsigned long long>() -> ctx_p_type<unsigned long long> { return ctx_ulonglong_p; }
+    template <> inline auto ctx_p<float>() -> ctx_p_type<float> { return ctx_float_p; }
+    template <> inline auto ctx_p<double>() -> ctx_p_type<double> { return ctx_double_p; }
+
+    template <typename T> static constexpr ctx_g_type<T> ctx_g() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
+    template <> inline auto ctx_g<uint8_t>() -> ctx_g_type<uint8_t> { return ctx_uint8_g; }
+    template <> inline auto ctx_g<uint16_t>() -> ctx_g_type<uint16_t> { return ctx_uint16_g; }
+    template <> inline auto ctx_g<uint32_t>() -> ctx_g_type<uint32_t> { return ctx_uint32_g; }
+    template <> inline auto ctx_g<uint64_t>() -> ctx_g_type<uint64_t> { return ctx_uint64_g; }
+    template <> inline auto ctx_g<unsigned long long>() -> ctx_g_type<unsigned long long> { return ctx_ulonglong_g; }
+    template <> inline auto ctx_g<float>() -> ctx_g_type<float> { return ctx_float_g; }
+    template <> inline auto ctx_g<double>() -> ctx_g_type<double> { return ctx_double_g; }
+
     template <typename T> static constexpr irma_type<T> iput() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
     template <> inline auto iput<uint8_t>() -> irma_type<uint8_t> { return uint8_iput; }
     template <> inline auto iput<uint16_t>() -> irma_type<uint16_t> { return uint16_iput; }
@@ -758,6 +842,12 @@ return ulonglong_atomic_compare_swap_nbi;
     template <> inline auto atomic_xor<int32_t>() -> atomic_op_type<int32_t> { return int32_atomic_xor; }
     template <> inline auto atomic_xor<int64_t>() -> atomic_op_type<int64_t> { return int64_atomic_xor; }
 
+    template <typename T> static constexpr alltoalls_type<T> alltoalls() { static_assert(assert_dependency<T>::value, "Undefined wrapper function"); }
+    template <> inline auto alltoalls<uint8_t>() -> alltoalls_type<uint8_t> { return uint8_alltoalls; }
+    template <> inline auto alltoalls<uint16_t>() -> alltoalls_type<uint16_t> { return uint16_alltoalls; }
+    template <> inline auto alltoalls<uint32_t>() -> alltoalls_type<uint32_t> { return uint32_alltoalls; }
+    template <> inline auto alltoalls<uint64_t>() -> alltoalls_type<uint64_t> { return uint64_alltoalls; }
+
     template <typename T, ishmemi_op_t OP> static constexpr reduce_type<T> reduce() { static_assert(assert_dependency_op<T, OP>::value, "Undefined wrapper function"); }
     template <> inline auto reduce<uint8_t, AND_REDUCE>() -> reduce_type<uint8_t> { return uint8_and_reduce; }
     template <> inline auto reduce<uint8_t, OR_REDUCE>() -> reduce_type<uint8_t> { return uint8_or_reduce; }
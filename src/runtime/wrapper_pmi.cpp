@@ -12,17 +12,22 @@
 namespace ishmemi_pmi_wrappers {
     static bool initialized = false;
 
-    int (*Abort)(int, char *);
+    int (*Abort)(int, const char[]);
     int (*Barrier)();
     int (*Finalize)();
     int (*Get_rank)(int *);
     int (*Get_size)(int *);
     int (*Init)(int *);
     int (*Initialized)(int *);
+    int (*KVS_Commit)(const char[]);
+    bool kvs_fence_exists;
+    int (*KVS_Fence)(const char[], const char[]);
+    int (*KVS_Get)(const char[], const char[], char[], int);
     int (*KVS_Get_key_length_max)(int *);
     int (*KVS_Get_my_name)(char *, int);
     int (*KVS_Get_name_length_max)(int *);
     int (*KVS_Get_value_length_max)(int *);
+    int (*KVS_Put)(const char[], const char[], const char[]);
 
     /* dl handle */
     void *pmi_handle = nullptr;
@@ -46,7 +51,6 @@ namespace ishmemi_pmi_wrappers {
     int init_wrappers(void)
     {
         int ret = 0;
-        void *pmi_handle = nullptr;
 
         const char *pmi_libname = ishmemi_params.PMI_LIB_NAME.c_str();
 
@@ -63,10 +67,17 @@ namespace ishmemi_pmi_wrappers {
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, Get_size);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, Init);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, Initialized);
+        ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Commit);
+        ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Get);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Get_key_length_max);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Get_my_name);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Get_name_length_max);
         ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Get_value_length_max);
+        ISHMEMI_LINK_SYMBOL(pmi_handle, PMI, KVS_Put);
+
+        /* Batched key exchange, only in the bundled simple PMI */
+        kvs_fence_exists = true;
+        ISHMEMI_TRY_LINK_SYMBOL(pmi_handle, PMI, KVS_Fence, kvs_fence_exists);
 
     fn_exit:
         return ret;
@@ -11,17 +11,22 @@ namespace ishmemi_pmi_wrappers {
     int init_wrappers(void);
     int fini_wrappers(void);
 
-    extern int (*Abort)(int, char *);
+    extern int (*Abort)(int, const char[]);
     extern int (*Barrier)();
     extern int (*Finalize)();
     extern int (*Get_rank)(int *);
     extern int (*Get_size)(int *);
     extern int (*Init)(int *);
     extern int (*Initialized)(int *);
+    extern int (*KVS_Commit)(const char[]);
+    extern bool kvs_fence_exists;
+    extern int (*KVS_Fence)(const char[], const char[]);
+    extern int (*KVS_Get)(const char[], const char[], char[], int);
     extern int (*KVS_Get_key_length_max)(int *);
     extern int (*KVS_Get_my_name)(char *, int);
     extern int (*KVS_Get_name_length_max)(int *);
     extern int (*KVS_Get_value_length_max)(int *);
+    extern int (*KVS_Put)(const char[], const char[], const char[]);
 }  // namespace ishmemi_pmi_wrappers
 
 #endif
@@ -13,11 +13,16 @@
 #include "collectives.h"
 #include "collectives/reduce_impl.h"
 #include "accelerator.h"
+#include "runtime_ipc.h"
+#include <algorithm>
+#include <climits>
 #include <cmath>
+#include <cstring>
 
 #define ISHMEMI_TEAMS_MIN   3 /* The number of pre-defined teams */
 #define ISHMEMI_DIAG_STRLEN 1024
-#define N_PSYNC_BYTES       8
+/* The smallest chunk of a pipelined host reduction, which must hold at least one element */
+#define ISHMEMI_REDUCE_PIPELINE_CHUNK_MIN 4096
 /* TODO determine ISHMEMI_SYNC_SIZE at configuration */
 #define ISHMEMI_SYNC_SIZE 32
 #define PSYNC_CHUNK_SIZE  (N_PSYNCS_PER_TEAM * ISHMEMI_SYNC_SIZE)
@@ -26,6 +31,8 @@ static int team_ret_val; /* These are globals so they can be used in a collectiv
 static int team_ret_val_reduced;
 static unsigned char psync_pool_avail[N_PSYNC_BYTES];
 static unsigned char psync_pool_avail_reduced[N_PSYNC_BYTES];
+static uint8_t *team_buffer_chunks[ISHMEMI_TEAM_CHUNKS_MAX]; /* Device reduction buffers */
+static uint8_t *team_bounce_chunks[ISHMEMI_TEAM_CHUNKS_MAX]; /* Symmetric host bounce buffers */
 
 /* Checks whether a PE has a consistent stride given (start, stride, size).
  * This function is useful within a loop across PE IDs, and sets 'start',
@@ -102,9 +109,226 @@ static int team_init(ishmem_team_t team, int my_pe, int start, int stride, int s
     SET_HEAP_FIELD(team_device->last_pe, team_host->last_pe);
     SET_HEAP_FIELD(team_device->my_pe, team_host->my_pe);
 
+    uint8_t *buffer = team_buffer_chunks[team / ISHMEMI_TEAM_CHUNK_SIZE] +
+                      (team % ISHMEMI_TEAM_CHUNK_SIZE) * ISHMEM_REDUCE_BUFFER_SIZE;
+    SET_HEAP_FIELD(team_device->buffer, buffer);
+
+    /* With a symmetric runtime malloc, the bounce buffers come with the chunk of the team */
+    uint8_t *bounce = team_bounce_chunks[team / ISHMEMI_TEAM_CHUNK_SIZE];
+    if (bounce != nullptr) {
+        size_t size = 2 * ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE;
+        team_host->source = bounce + (team % ISHMEMI_TEAM_CHUNK_SIZE) * 2 * size;
+        team_host->dest = team_host->source + size;
+    }
+
     return (0);
 }
 
+/* Adds a chunk of teams to the host and device pools.  The device chunk and its reduction buffers
+ * are symmetric, so this is collective over all PEs.  When the runtime malloc is symmetric, the
+ * host bounce buffers of the teams in the chunk are allocated here as well, since a team's first
+ * host reduction is only reached by its members */
+static int team_pool_grow(void)
+{
+    size_t chunk = ishmemi_cpu_info->n_teams / ISHMEMI_TEAM_CHUNK_SIZE;
+    ishmemi_team_host_t *host_chunk = nullptr;
+    ishmemi_team_device_t *device_chunk = nullptr;
+    uint8_t *buffers = nullptr;
+    uint8_t *bounce = nullptr;
+
+    ISHMEM_CHECK_GOTO_MSG(chunk >= ISHMEMI_TEAM_CHUNKS_MAX, fn_fail, "Team pool is full\n");
+
+    host_chunk = (ishmemi_team_host_t *) ishmemi_runtime->calloc(ISHMEMI_TEAM_CHUNK_SIZE,
+                                                                 sizeof(ishmemi_team_host_t));
+    ISHMEM_CHECK_GOTO_MSG(host_chunk == nullptr, fn_fail, "Allocation of team host pool failed\n");
+    device_chunk = (ishmemi_team_device_t *) ishmemi_calloc(ISHMEMI_TEAM_CHUNK_SIZE,
+                                                            sizeof(ishmemi_team_device_t));
+    ISHMEM_CHECK_GOTO_MSG(device_chunk == nullptr, fn_fail,
+                          "Allocation of device team pool failed\n");
+    buffers = (uint8_t *) ishmemi_calloc(ISHMEMI_TEAM_CHUNK_SIZE, ISHMEM_REDUCE_BUFFER_SIZE);
+    ISHMEM_CHECK_GOTO_MSG(buffers == nullptr, fn_fail,
+                          "Allocation of team reduction buffers failed\n");
+    if (ishmemi_runtime->malloc_is_symmetric()) {
+        bounce = (uint8_t *) ishmemi_runtime->malloc(ISHMEMI_TEAM_CHUNK_SIZE * 4 *
+                                                     ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE);
+        ISHMEM_CHECK_GOTO_MSG(bounce == nullptr, fn_fail,
+                              "Allocation of team bounce buffers failed\n");
+    }
+
+    ishmemi_cpu_info->team_host_pool.chunks[chunk] = host_chunk;
+    ishmemi_mmap_gpu_info->team_device_pool.chunks[chunk] = device_chunk;
+    team_buffer_chunks[chunk] = buffers;
+    team_bounce_chunks[chunk] = bounce;
+    ishmemi_cpu_info->n_teams = std::min(ishmemi_cpu_info->n_teams + ISHMEMI_TEAM_CHUNK_SIZE,
+                                         static_cast<size_t>(ishmemi_params.TEAMS_MAX));
+    ishmemi_mmap_gpu_info->n_teams = ishmemi_cpu_info->n_teams;
+    ISHMEM_DEBUG_MSG("Team pool grew to %zu teams\n", ishmemi_cpu_info->n_teams);
+    return 0;
+
+fn_fail:
+    ISHMEMI_FREE(ishmemi_runtime->free, bounce);
+    ISHMEMI_FREE(ishmemi_free, buffers);
+    ISHMEMI_FREE(ishmemi_free, device_chunk);
+    ISHMEMI_FREE(ishmemi_runtime->free, host_chunk);
+    return -1;
+}
+
+/* The pool can only grow when every PE takes part, which a split of a parent team holding all PEs
+ * assures.  The result is the same on all PEs of the parent team */
+static inline bool team_pool_can_grow(ishmemi_team_host_t *parent_team)
+{
+    return (parent_team->size == ishmemi_n_pes) &&
+           (ishmemi_cpu_info->n_teams < static_cast<size_t>(ishmemi_params.TEAMS_MAX));
+}
+
+/* Reports a split that found no free team, which the caller does on the members only */
+static void team_pool_warn_full(ishmemi_team_host_t *parent_team)
+{
+    if (team_pool_can_grow(parent_team) ||
+        ishmemi_cpu_info->n_teams >= static_cast<size_t>(ishmemi_params.TEAMS_MAX)) {
+        ISHMEM_WARN_MSG("No more teams available (max = %ld), try increasing SHMEM_TEAMS_MAX\n",
+                        ishmemi_params.TEAMS_MAX);
+    } else {
+        ISHMEM_WARN_MSG("No more teams available (%zu allocated), only splits of a team with all "
+                        "PEs allocate more, try increasing ISHMEM_TEAMS_PREALLOC\n",
+                        ishmemi_cpu_info->n_teams);
+    }
+}
+
+/* Returns the first team slot free in the given bitmap among the allocated teams */
+static inline ishmem_team_t team_pool_select(const unsigned char *avail)
+{
+    size_t n_teams = ishmemi_cpu_info->n_teams;
+    size_t slot = ishmemi_bit_1st_nonzero(avail, (n_teams + CHAR_BIT - 1) / CHAR_BIT);
+    if (slot >= n_teams) return ISHMEM_TEAM_INVALID;
+    return static_cast<ishmem_team_t>(slot);
+}
+
+/* Reserves a free slot and fills in the new team on one of its members, except for its runtime
+ * team */
+static void team_fill(ishmem_team_t team, int my_team_pe, int start, int stride, int size,
+                      const ishmem_team_config_t *config, long config_mask)
+{
+    ishmemi_bit_clear(psync_pool_avail, N_PSYNC_BYTES, static_cast<size_t>(team));
+    team_init(team, my_team_pe, start, stride, size);
+
+    ishmemi_team_host_t *host_team = &ishmemi_cpu_info->team_host_pool[team];
+    ishmemi_team_device_t *device_team = &ishmemi_mmap_gpu_info->team_device_pool[team];
+    host_team->config_mask = (size_t) config_mask;
+    if (config_mask == 0) {
+        host_team->config.num_contexts = 0;
+    } else {
+        host_team->config = *config;
+    }
+    SET_HEAP_FIELD(device_team->config_mask, host_team->config_mask);
+    SET_HEAP_FIELD(device_team->config, host_team->config);
+}
+
+/* Only the members of a team reach its first host reduction, so the bounce buffers allocated here
+ * are private memory.  Runtimes with a symmetric malloc get them from team_pool_grow instead */
+int ishmemi_team_alloc_bounce_buffers(ishmemi_team_host_t *team)
+{
+    /* Double buffered for the pipeline in ishmemi_generic_op_reduce */
+    size_t size = 2 * ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE;
+    team->source = (uint8_t *) ::malloc(size);
+    team->dest = (uint8_t *) ::malloc(size);
+    if (team->source == nullptr || team->dest == nullptr) {
+        ISHMEM_ERROR_MSG("Allocation of team bounce buffers failed\n");
+        ISHMEMI_FREE(::free, team->source);
+        ISHMEMI_FREE(::free, team->dest);
+        return -1;
+    }
+    return 0;
+}
+
+/* Frees the bounce buffers of a team, unless they belong to the symmetric block of its chunk */
+static void team_free_bounce_buffers(ishmem_team_t team, ishmemi_team_host_t *host_team)
+{
+    if (team_bounce_chunks[team / ISHMEMI_TEAM_CHUNK_SIZE] == nullptr) {
+        ISHMEMI_FREE(::free, host_team->source);
+        ISHMEMI_FREE(::free, host_team->dest);
+    }
+    host_team->source = nullptr;
+    host_team->dest = nullptr;
+}
+
+/* Enables hierarchical collectives on ISHMEM_TEAM_WORLD when requested and when every node holds
+ * the same number of consecutive PEs, then creates the team of node leaders */
+static int team_hierarchy_init(void)
+{
+    int ret = 0;
+    ishmemi_team_host_t *world = &ishmemi_cpu_info->team_host_pool[ISHMEM_TEAM_WORLD];
+    ishmemi_team_host_t *node = &ishmemi_cpu_info->team_host_pool[ISHMEMX_TEAM_NODE];
+    ishmem_team_t leader_team = ISHMEM_TEAM_INVALID;
+
+    ishmemi_cpu_info->hierarchical = false;
+    ishmemi_cpu_info->leader_team = ISHMEM_TEAM_INVALID;
+    ishmemi_mmap_gpu_info->hierarchical = false;
+    ishmemi_mmap_gpu_info->leader_team = ISHMEM_TEAM_INVALID;
+
+    /* Every PE reads the same parameter, so all of them return here or none do */
+    if (!ishmemi_params.ENABLE_HIERARCHICAL_COLLECTIVES || world->only_intra) return 0;
+
+    /* Check the node layout: a PE on an unsuitable node votes against by reporting INT_MAX */
+    bool block_layout = node->only_intra && node->stride == 1 && node->size > 1 &&
+                        (ishmemi_n_pes % node->size) == 0 && (node->start % node->size) == 0;
+    int node_size = node->size;
+
+    /* Both the largest and the smallest node size must match this PE's for a uniform layout */
+    team_ret_val = block_layout ? node_size : INT_MAX;
+    ret = ishmemi_runtime->int_max_reduce(world->runtime_team, &team_ret_val_reduced,
+                                          &team_ret_val, 1);
+    ISHMEM_CHECK_RETURN_MSG(ret, "Call to ishmemi_int_max_reduce failed\n");
+    bool uniform = (team_ret_val_reduced == node_size);
+
+    team_ret_val = block_layout ? -node_size : INT_MAX;
+    ret = ishmemi_runtime->int_max_reduce(world->runtime_team, &team_ret_val_reduced,
+                                          &team_ret_val, 1);
+    ISHMEM_CHECK_RETURN_MSG(ret, "Call to ishmemi_int_max_reduce failed\n");
+    uniform = uniform && (team_ret_val_reduced == -node_size);
+
+    if (!uniform) {
+        if (ishmemi_my_pe == 0) {
+            ISHMEM_WARN_MSG("%s\n", "Hierarchical collectives need the same number of consecutive "
+                                     "PEs on every node, using flat collectives");
+        }
+        return 0;
+    }
+
+    ret = ishmemi_team_split_strided(ISHMEM_TEAM_WORLD, 0, node_size, ishmemi_n_pes / node_size,
+                                     NULL, 0, &leader_team);
+    ISHMEM_CHECK_RETURN_MSG(ret, "Creation of the node leader team failed\n");
+
+    ishmemi_cpu_info->hierarchical = true;
+    ishmemi_cpu_info->leader_team = leader_team;
+    ishmemi_mmap_gpu_info->hierarchical = true;
+    ishmemi_mmap_gpu_info->leader_team = leader_team;
+    ISHMEM_DEBUG_MSG("Hierarchical collectives enabled: node size %d, leader team %d\n", node_size,
+                     (int) leader_team);
+
+    return 0;
+}
+
+/* Releases every chunk of the team pools, along with the bounce buffers of their teams */
+static void team_pool_free(void)
+{
+    size_t n_chunks = (ishmemi_cpu_info->n_teams + ISHMEMI_TEAM_CHUNK_SIZE - 1) /
+                      ISHMEMI_TEAM_CHUNK_SIZE;
+    for (size_t chunk = 0; chunk < n_chunks; chunk++) {
+        ishmemi_team_host_t *host_chunk = ishmemi_cpu_info->team_host_pool.chunks[chunk];
+        for (size_t i = 0; host_chunk != nullptr && i < ISHMEMI_TEAM_CHUNK_SIZE; i++) {
+            team_free_bounce_buffers(
+                static_cast<ishmem_team_t>(chunk * ISHMEMI_TEAM_CHUNK_SIZE + i), &host_chunk[i]);
+        }
+        ISHMEMI_FREE(ishmemi_runtime->free, team_bounce_chunks[chunk]);
+        ISHMEMI_FREE(ishmemi_free, team_buffer_chunks[chunk]);
+        ISHMEMI_FREE(ishmemi_free, ishmemi_mmap_gpu_info->team_device_pool.chunks[chunk]);
+        ISHMEMI_FREE(ishmemi_runtime->free, ishmemi_cpu_info->team_host_pool.chunks[chunk]);
+    }
+    ishmemi_cpu_info->n_teams = 0;
+    ishmemi_mmap_gpu_info->n_teams = 0;
+}
+
 int ishmemi_team_init(void)
 {
     int ret = 0;
@@ -115,13 +339,47 @@ int ishmemi_team_init(void)
     int my_team_pe;
     ishmemi_team_host_t *host_team;
 
-    size_t n_teams = static_cast<size_t>(ishmemi_params.TEAMS_MAX);
     if (ishmemi_params.TEAMS_MAX < ISHMEMI_TEAMS_MIN) ishmemi_params.TEAMS_MAX = ISHMEMI_TEAMS_MIN;
-    ishmemi_cpu_info->n_teams = n_teams;
-    ishmemi_mmap_gpu_info->n_teams = n_teams;
+    if (ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE < ISHMEMI_REDUCE_PIPELINE_CHUNK_MIN)
+        ishmemi_params.REDUCE_PIPELINE_CHUNK_SIZE = ISHMEMI_REDUCE_PIPELINE_CHUNK_MIN;
+    if (ishmemi_params.TEAMS_MAX > ISHMEMI_TEAMS_LIMIT) {
+        ISHMEM_ERROR_MSG("Requested %ld teams, but only %d are supported\n",
+                         ishmemi_params.TEAMS_MAX, ISHMEMI_TEAMS_LIMIT);
+        return -1;
+    }
+    ishmemi_cpu_info->n_teams = 0;
+    ishmemi_mmap_gpu_info->n_teams = 0;
+
+    if (strcasecmp(ishmemi_params.TEAM_SYNC_ALGORITHM.c_str(), "dissemination") == 0) {
+        ishmemi_cpu_info->team_sync_algorithm = ISHMEMI_TEAM_SYNC_DISSEMINATION;
+    } else {
+        if (strcasecmp(ishmemi_params.TEAM_SYNC_ALGORITHM.c_str(), "linear") != 0) {
+            ISHMEM_WARN_MSG("Unknown ISHMEM_TEAM_SYNC_ALGORITHM '%s', using 'linear'\n",
+                            ishmemi_params.TEAM_SYNC_ALGORITHM.c_str());
+        }
+        ishmemi_cpu_info->team_sync_algorithm = ISHMEMI_TEAM_SYNC_LINEAR;
+    }
+    ishmemi_mmap_gpu_info->team_sync_algorithm = ishmemi_cpu_info->team_sync_algorithm;
+
+    if (strcasecmp(ishmemi_params.ALLTOALL_SCHEDULE.c_str(), "linear") == 0) {
+        ishmemi_cpu_info->alltoall_schedule = ISHMEMI_ALLTOALL_LINEAR;
+    } else {
+        if (strcasecmp(ishmemi_params.ALLTOALL_SCHEDULE.c_str(), "pairwise") != 0) {
+            ISHMEM_WARN_MSG("Unknown ISHMEM_ALLTOALL_SCHEDULE '%s', using 'pairwise'\n",
+                            ishmemi_params.ALLTOALL_SCHEDULE.c_str());
+        }
+        ishmemi_cpu_info->alltoall_schedule = ISHMEMI_ALLTOALL_PAIRWISE;
+    }
+    ishmemi_mmap_gpu_info->alltoall_schedule = ishmemi_cpu_info->alltoall_schedule;
+    ishmemi_cpu_info->reduce_rsag_cutover = ishmemi_params.REDUCE_RSAG_CUTOVER;
+    ishmemi_mmap_gpu_info->reduce_rsag_cutover = ishmemi_params.REDUCE_RSAG_CUTOVER;
+    ishmemi_cpu_info->bcast_pipeline_cutover = ishmemi_params.BROADCAST_PIPELINE_CUTOVER;
+    ishmemi_mmap_gpu_info->bcast_pipeline_cutover = ishmemi_params.BROADCAST_PIPELINE_CUTOVER;
+    ishmemi_cpu_info->bcast_pipeline_chunk = ishmemi_params.BROADCAST_PIPELINE_CHUNK_SIZE;
+    ishmemi_mmap_gpu_info->bcast_pipeline_chunk = ishmemi_params.BROADCAST_PIPELINE_CHUNK_SIZE;
 
     ::memset(psync_pool_avail, 0, N_PSYNC_BYTES);
-    for (size_t i = 0; i < ishmemi_mmap_gpu_info->n_teams; i++) {
+    for (size_t i = 0; i < ishmemi_params.TEAMS_MAX; i++) {
         ishmemi_bit_set(psync_pool_avail, N_PSYNC_BYTES, i);
     }
 
@@ -130,16 +388,13 @@ int ishmemi_team_init(void)
     ishmemi_bit_clear(psync_pool_avail, N_PSYNC_BYTES, ISHMEM_TEAM_SHARED);
     ishmemi_bit_clear(psync_pool_avail, N_PSYNC_BYTES, ISHMEMX_TEAM_NODE);
 
-    ishmemi_cpu_info->team_host_pool =
-        (ishmemi_team_host_t *) ishmemi_runtime->malloc(sizeof(ishmemi_team_host_t) * n_teams);
-    ISHMEM_CHECK_GOTO_MSG(ishmemi_cpu_info->team_host_pool == nullptr, cleanup,
-                          "Allocation of team host pool failed\n");
-    ::memset(ishmemi_cpu_info->team_host_pool, 0, sizeof(ishmemi_team_host_t) * n_teams);
-
-    ishmemi_mmap_gpu_info->team_device_pool =
-        (ishmemi_team_device_t *) ishmemi_calloc(n_teams, sizeof(ishmemi_team_device_t));
-    ISHMEM_CHECK_GOTO_MSG(ishmemi_mmap_gpu_info->team_device_pool == nullptr, cleanup,
-                          "Allocation of device team pool failed\n");
+    /* The first chunk holds the predefined teams.  Splits of parent teams without every PE cannot
+     * grow the pool, so allocate as many teams as they could always use up front */
+    do {
+        ret = team_pool_grow();
+        ISHMEM_CHECK_GOTO_MSG(ret, cleanup, "Allocation of the team pools failed\n");
+    } while (ishmemi_cpu_info->n_teams <
+             std::min(ishmemi_params.TEAMS_MAX, ishmemi_params.TEAMS_PREALLOC));
 
     /* Initialize ISHMEM_TEAM_WORLD */
     start = 0;
@@ -242,17 +497,12 @@ int ishmemi_team_init(void)
     ISHMEM_DEBUG_MSG("ISHMEMX_TEAM_NODE: start=%d, stride=%d, size=%d, n_local=%d\n",
                      host_team->start, host_team->stride, host_team->size, host_team->n_local_pes);
 
-    if (ishmemi_params.TEAMS_MAX > N_PSYNC_BYTES * CHAR_BIT) {
-        ISHMEM_ERROR_MSG("Requested %ld teams, but only %d are supported\n",
-                         ishmemi_params.TEAMS_MAX, N_PSYNC_BYTES * CHAR_BIT);
-        goto cleanup;
-    }
+    ret = team_hierarchy_init();
+    ISHMEM_CHECK_GOTO_MSG(ret, cleanup, "Initialization of hierarchical collectives failed\n");
     return 0;
 
 cleanup:
-    ISHMEMI_FREE(ishmemi_runtime->free, ishmemi_cpu_info->team_host_pool);
-    ISHMEMI_FREE(ishmemi_free, ishmemi_mmap_gpu_info->team_device_pool);
-
+    team_pool_free();
     return -1;
 }
 
@@ -268,6 +518,7 @@ void ishmemi_team_destroy(ishmem_team_t team)
     if (host_team->size > 0) {
         host_team->size = 0;
         ishmemi_bit_set(psync_pool_avail, N_PSYNC_BYTES, static_cast<size_t>(team));
+        team_free_bounce_buffers(team, host_team);
 
         ISHMEM_DEBUG_MSG("destroy team %d runtime_team\n", team);
         ishmemi_runtime->team_destroy(ishmemi_cpu_info->team_host_pool[team].runtime_team);
@@ -275,6 +526,10 @@ void ishmemi_team_destroy(ishmem_team_t team)
 }
 int ishmemi_team_fini(void)
 {
+    /* The leader team is destroyed with the user-created teams below */
+    ishmemi_cpu_info->hierarchical = false;
+    ishmemi_mmap_gpu_info->hierarchical = false;
+
     /* Destroy all undestroyed user-created teams */
     for (size_t i = ISHMEMI_TEAMS_MIN; i < ISHMEMI_N_TEAMS; i++) {
         ishmemi_team_host_t *team = &ishmemi_cpu_info->team_host_pool[i];
@@ -283,11 +538,83 @@ int ishmemi_team_fini(void)
         }
     }
 
-    /* Free the device team resources */
-    ISHMEMI_FREE(ishmemi_free, ishmemi_mmap_gpu_info->team_device_pool);
-    /* Free the host team resources */
-    ISHMEMI_FREE(ishmemi_runtime->free, ishmemi_cpu_info->team_host_pool);
+    /* Free the host and device team resources */
+    team_pool_free();
+
+    return 0;
+}
+
+/* Splits an intra-node parent team without the runtime.  The parent PEs exchange their free team
+ * slots over IPC and all pick the same slot, and the members create their runtime team lazily, so
+ * the runtime is only involved if an operation on the new team needs it.  This is collective over
+ * the parent team and returns the same value on all of its PEs */
+static int team_split_intra(ishmem_team_t parent_team_idx, int global_PE_start,
+                            int global_PE_stride, int PE_size, int my_team_pe,
+                            const ishmem_team_config_t *config, long config_mask,
+                            ishmem_team_t *new_team)
+{
+    int ret = 0;
+    ishmemi_team_host_t *parent_team = &ishmemi_cpu_info->team_host_pool[parent_team_idx];
+    ishmemi_team_device_t *parent_device =
+        &ishmemi_mmap_gpu_info->team_device_pool[parent_team_idx];
+    unsigned char(*slots)[N_PSYNC_BYTES] =
+        parent_device->split_avail[parent_team->split_epoch++ % 2];
+    unsigned char avail[N_PSYNC_BYTES];
+    struct put_item items[MAX_LOCAL_PES];
+
+    /* Non-members offer every slot, so that the result only depends on the members */
+    if (my_team_pe >= 0) {
+        ::memcpy(avail, psync_pool_avail, N_PSYNC_BYTES);
+    } else {
+        ::memset(avail, 0xff, N_PSYNC_BYTES);
+    }
+    for (int i = 0; i < parent_team->size; i++) {
+        items[i].pe = ishmemi_team_pe(parent_team, i);
+        items[i].src = avail;
+        items[i].size = N_PSYNC_BYTES;
+        items[i].dst = slots[parent_team->my_pe];
+    }
+    ret = ishmemi_ipc_put_v(parent_team->size, items);
+    ISHMEM_CHECK_RETURN_MSG(ret, "Exchange of team slots within team split failed\n");
+    ishmemi_team_sync_dissemination_host(parent_team_idx);
+
+    unsigned char *all_slots = (ishmemi_params.ENABLE_ACCESSIBLE_HOST_HEAP)
+                                   ? &slots[0][0]
+                                   : ISHMEMI_DEVICE_TO_MMAP_ADDR(unsigned char, &slots[0][0]);
+    ::memset(psync_pool_avail_reduced, 0xff, N_PSYNC_BYTES);
+    for (int i = 0; i < parent_team->size; i++) {
+        for (int byte = 0; byte < N_PSYNC_BYTES; byte++) {
+            psync_pool_avail_reduced[byte] &= all_slots[(i * N_PSYNC_BYTES) + byte];
+        }
+    }
+
+    ishmem_team_t team = team_pool_select(psync_pool_avail_reduced);
+    if (team == ISHMEM_TEAM_INVALID && team_pool_can_grow(parent_team)) {
+        /* The parent team holds every PE, so all of them grow the pool together */
+        ret = team_pool_grow();
+        ISHMEM_CHECK_RETURN_MSG(ret, "Growth of the team pool failed\n");
+        team = team_pool_select(psync_pool_avail_reduced);
+    }
+    if (team == ISHMEM_TEAM_INVALID) {
+        if (my_team_pe >= 0) team_pool_warn_full(parent_team);
+        /* Every PE of the parent team computed the same slot, so all of them fail together */
+        ishmemi_team_sync_dissemination_host(parent_team_idx);
+        return 1;
+    }
+
+    if (my_team_pe >= 0) {
+        team_fill(team, my_team_pe, global_PE_start, global_PE_stride, PE_size, config,
+                  config_mask);
+        /* Every member picked the same slot, which no other live team holds */
+        ret = ishmemi_runtime->team_create_lazy(
+            global_PE_start, global_PE_stride, PE_size, my_team_pe, static_cast<int>(team),
+            &ishmemi_cpu_info->team_host_pool[team].runtime_team);
+        ISHMEM_CHECK_RETURN_MSG(ret, "Lazy creation of the runtime team failed\n");
+        *new_team = team;
+    }
 
+    /* Assure every member initialized the new team before any of them uses it */
+    ishmemi_team_sync_dissemination_host(parent_team_idx);
     return 0;
 }
 
@@ -324,6 +651,20 @@ int ishmemi_team_split_strided(ishmem_team_t parent_team_idx, int PE_start, int
         return -1;
     }
 
+    if (config_mask != 0 && config_mask != ISHMEM_TEAM_NUM_CONTEXTS) {
+        ISHMEM_WARN_MSG("Invalid team_split_strided config_mask (%ld)\n", config_mask);
+        return 1;  // everyone should hit this if anyone does
+    }
+
+    /* An intra-node parent only has intra-node children, which need no runtime split */
+    if (parent_team->only_intra && ishmemi_params.TEAM_LAZY_CREATE &&
+        ishmemi_runtime->team_lazy_supported()) {
+        return team_split_intra(parent_team_idx, global_PE_start, global_PE_stride, PE_size,
+                                ishmemi_pe_in_active_set(ishmemi_my_pe, global_PE_start,
+                                                         global_PE_stride, PE_size),
+                                config, config_mask, new_team);
+    }
+
     /* do the bit reduction to find a team slot, then fill it in */
 
     team_ret_val = 0;
@@ -358,17 +699,18 @@ int ishmemi_team_split_strided(ishmem_team_t parent_team_idx, int PE_start, int
         ISHMEM_DEBUG_MSG("My pSyncs  [ %s ]\n", bit_str);
 
         /* Select the least signficant nonzero bit, which corresponds to an available pSync. */
-        *new_team = static_cast<ishmem_team_t>(
-            ishmemi_bit_1st_nonzero(psync_pool_avail_reduced, N_PSYNC_BYTES));
-        /* ishmemi_bit_1st_nonzero returns -1 if it cannot find any non-zero bits */
+        *new_team = team_pool_select(psync_pool_avail_reduced);
+        /* team_pool_select returns ISHMEM_TEAM_INVALID if no allocated team is free */
 
         ishmemi_bit_to_string(bit_str, ISHMEMI_DIAG_STRLEN, psync_pool_avail_reduced,
                               N_PSYNC_BYTES);
         ISHMEM_DEBUG_MSG("All pSyncs [ %s ], allocated %d\n", bit_str, *new_team);
 
-        if (*new_team == ISHMEM_TEAM_INVALID || *new_team >= (long) ishmemi_params.TEAMS_MAX) {
-            ISHMEM_WARN_MSG("No more teams available (max = %ld), try increasing SHMEM_TEAMS_MAX\n",
-                            ishmemi_params.TEAMS_MAX);
+        if (*new_team == ISHMEM_TEAM_INVALID && team_pool_can_grow(parent_team)) {
+            /* Ask every PE of the parent team to grow the pool, then take a slot from it */
+            team_ret_val = 2;
+        } else if (*new_team == ISHMEM_TEAM_INVALID) {
+            team_pool_warn_full(parent_team);
             /* No psync was available, but must call barrier across parent team before returning. */
             *new_team = ISHMEM_TEAM_INVALID;
             team_ret_val = 1;
@@ -392,12 +734,7 @@ int ishmemi_team_split_strided(ishmem_team_t parent_team_idx, int PE_start, int
         }
         defaults.num_contexts = 0;
     } else {
-        if (config_mask != ISHMEM_TEAM_NUM_CONTEXTS) {
-            ISHMEM_WARN_MSG("Invalid team_split_strided config_mask (%ld)\n", config_mask);
-            return 1;  // everyone should hit this if anyone does
-        } else {
-            assert(config->num_contexts >= 0);
-        }
+        assert(config->num_contexts >= 0);
     }
 
     if (*new_team != ISHMEM_TEAM_INVALID) {
@@ -430,6 +767,21 @@ int ishmemi_team_split_strided(ishmem_team_t parent_team_idx, int PE_start, int
                                           &team_ret_val, 1);
     ISHMEM_CHECK_RETURN_MSG(ret, "Call to ishmemi_int_max_reduce failed\n");
 
+    /* The members found the pool full; the parent team holds every PE, so all of them grow it */
+    if (team_ret_val_reduced == 2) {
+        ret = team_pool_grow();
+        ISHMEM_CHECK_GOTO_MSG(ret, cleanup, "Growth of the team pool failed\n");
+        if (my_team_pe >= 0) {
+            *new_team = team_pool_select(psync_pool_avail_reduced);
+            team_fill(*new_team, my_team_pe, global_PE_start, global_PE_stride, PE_size, config,
+                      config_mask);
+            ishmemi_cpu_info->team_host_pool[*new_team].runtime_team = new_runtime_team;
+        }
+        ret = ishmemi_runtime->team_sync(parent_team->runtime_team);
+        ISHMEM_CHECK_RETURN_MSG(ret, "Call to ishmemi_runtime->team_sync failed\n");
+        return 0;
+    }
+
     /* If no team was available, print some team triplet info and return nonzero. */
     if (my_team_pe >= 0 && *new_team == ISHMEM_TEAM_INVALID) {
         if (host_team != nullptr) {
@@ -9,6 +9,7 @@
 #ifndef ISHMEM_TEAMS_H
 #define ISHMEM_TEAMS_H
 
+#include <climits>
 #include <cstddef>
 #include "ishmem.h"
 #include "ishmem/util.h"
@@ -17,6 +18,28 @@
 
 #define N_PSYNCS_PER_TEAM 2
 
+/* Teams are kept in pools that grow by ISHMEMI_TEAM_CHUNK_SIZE teams at a time, up to
+ * ISHMEM_TEAMS_MAX, which cannot exceed ISHMEMI_TEAMS_LIMIT */
+#define ISHMEMI_TEAMS_LIMIT     512
+#define ISHMEMI_TEAM_CHUNK_SIZE 16
+#define ISHMEMI_TEAM_CHUNKS_MAX (ISHMEMI_TEAMS_LIMIT / ISHMEMI_TEAM_CHUNK_SIZE)
+#define N_PSYNC_BYTES           (ISHMEMI_TEAMS_LIMIT / CHAR_BIT)
+
+/* Maximum number of dissemination rounds, ceil(log2(MAX_LOCAL_PES)) */
+#define ISHMEMI_SYNC_MAX_ROUNDS 6
+
+/* Algorithms for intra-node ishmemi_team_sync, selected by ISHMEM_TEAM_SYNC_ALGORITHM */
+typedef enum : uint8_t {
+    ISHMEMI_TEAM_SYNC_LINEAR,
+    ISHMEMI_TEAM_SYNC_DISSEMINATION,
+} ishmemi_team_sync_algorithm_t;
+
+/* Schedules for intra-node device alltoall, selected by ISHMEM_ALLTOALL_SCHEDULE */
+typedef enum : uint8_t {
+    ISHMEMI_ALLTOALL_LINEAR,
+    ISHMEMI_ALLTOALL_PAIRWISE,
+} ishmemi_alltoall_schedule_t;
+
 /* every team has an ishmemi_team_device_t which is device resident, and an ishmemi_team_host_t,
  * which is host resident.  They contain fields which are duplicated between host and device.  In
  * addition, the host structure has bounce buffers "source and dest" which are used for host
@@ -32,6 +55,16 @@
  * Therefore it is possile for a pe to enter the following sync before some other pe has left the
  * first one.  You need two copies of psync.
  *
+ * The dissemination sync does not use psync.  Instead, each pe keeps a count of the syncs it has
+ * entered (sync_epoch), and in round k writes that count into sync_flags[k] of the pe 2^k ahead of
+ * it in the team.  Since the flags only ever increase, they need no reset between syncs.  Device
+ * and host syncs use separate flags (sync_flags and host_sync_flags) and separate epochs (the
+ * device and host copies of sync_epoch).
+ *
+ * The pipelined broadcast works the same way.  Each pe counts the chunks of all pipelined
+ * broadcasts on the team (bcast_chunks), and the pe before it in the chain writes the running count
+ * of chunks it has forwarded into bcast_ready (or host_bcast_ready for host calls).
+ *
  * With psync either all pes are running on-device or all pes are running on-host.  Calls to sync
  * that are split between device code and host code do not work, because the different pes would be
  * using different psync words. The two copies of psync_idx are synchronized across the team, but
@@ -43,7 +76,15 @@
  * collect.
  *
  * The "buffer" is used to implement in-place reductions.  First, the input buffer is copied to the
- * buffer, then an out of place reduction is used.
+ * buffer, then an out of place reduction is used.  The buffers are symmetric, so they are allocated
+ * together with the chunk of the pool that holds the team.  The host bounce buffers are only used
+ * by host reductions, so they are private memory allocated by the first one on the team, unless
+ * the runtime needs symmetric buffers, in which case they are allocated with the chunk as well.
+ *
+ * The split_avail field is used when an intra-node team is split without the runtime.  Each pe of
+ * the parent team copies its bitmap of free team slots into split_avail[parity][parent pe] of every
+ * other parent pe, where the parity alternates between splits (split_epoch) for the same reason
+ * psync does.  After an IPC sync, every pe combines the same bitmaps and picks the same slot.
  */
 
 #define SET_HEAP_FIELD(to, value) ishmemi_copy(&to, &value, sizeof(to))
@@ -61,27 +102,48 @@ struct ishmemi_team_device_t {
     int last_pe;      // start + (stride * (size-1))
     int psync_idx;    // ishmem_team_t is just an integer index into the team pool
     long psync[N_PSYNCS_PER_TEAM];
+    long sync_epoch;                                // number of dissemination syncs entered
+    long sync_flags[ISHMEMI_SYNC_MAX_ROUNDS];       // dissemination flags written from device
+    long host_sync_flags[ISHMEMI_SYNC_MAX_ROUNDS];  // dissemination flags written from host
+    long bcast_chunks;                              // number of pipelined broadcast chunks seen
+    long bcast_ready;                               // pipelined broadcast signal from device
+    long host_bcast_ready;                          // pipelined broadcast signal from host
     size_t config_mask;
     ishmem_team_config_t config;
     size_t collect_mynelems;               // device symmetric scratch buffer for my PE's nelems
     size_t collect_nelems[MAX_LOCAL_PES];  // device symmetric scratch buffer for all PE's nelems
-    uint8_t buffer[ISHMEM_REDUCE_BUFFER_SIZE];  // reduction buffer for in-place intra-node
+    unsigned char split_avail[2][MAX_LOCAL_PES][N_PSYNC_BYTES];  // team slots free on each PE
+    uint8_t *buffer;  // ISHMEM_REDUCE_BUFFER_SIZE reduction buffer for in-place intra-node
 };
 
 /* The host structure has all the fields of the device structure, plus a few more */
 struct ishmemi_team_host_t : ishmemi_team_device_t {
     ishmemi_runtime_team_t runtime_team;
-    uint8_t source[ISHMEM_REDUCE_BUFFER_SIZE];  // host bounce buffer for internode
-    uint8_t dest[ISHMEM_REDUCE_BUFFER_SIZE];    // host bounce buffer for internode
+    long split_epoch;  // number of splits of this team done without the runtime
+    uint8_t *source;  // 2 x ISHMEM_REDUCE_PIPELINE_CHUNK_SIZE host bounce buffers for internode
+    uint8_t *dest;    // 2 x ISHMEM_REDUCE_PIPELINE_CHUNK_SIZE host bounce buffers for internode
 };
 
 typedef struct ishmemi_team_device_t ishmemi_team_device_t;
 typedef struct ishmemi_team_host_t ishmemi_team_host_t;
 
+/* A team pool is a table of chunks, so that it can grow without moving the teams it holds.  Only
+ * the first n_teams / ISHMEMI_TEAM_CHUNK_SIZE chunks are allocated */
+template <typename T>
+struct ishmemi_team_pool_t {
+    T *chunks[ISHMEMI_TEAM_CHUNKS_MAX];
+
+    T &operator[](long team)
+    {
+        return chunks[team / ISHMEMI_TEAM_CHUNK_SIZE][team % ISHMEMI_TEAM_CHUNK_SIZE];
+    }
+};
+
 /* Team Management Routines */
 int ishmemi_team_init(void);
 int ishmemi_team_fini(void);
 void ishmemi_team_destroy(ishmem_team_t team);
+int ishmemi_team_alloc_bounce_buffers(ishmemi_team_host_t *team);
 
 int ishmemi_team_split_strided(ishmem_team_t parent_team, int PE_start, int PE_stride, int PE_size,
                                const ishmem_team_config_t *config, long config_mask,
@@ -91,7 +153,7 @@ int ishmemi_team_split_2d(ishmem_team_t parent_team, int xrange,
                           ishmem_team_t *xaxis_team, const ishmem_team_config_t *yaxis_config,
                           long yaxis_mask, ishmem_team_t *yaxis_team);
 
-#define ishmemi_team_pe(team_ptr, pe) (team_ptr->start + (team_ptr->stride * pe))
+#define ishmemi_team_pe(team_ptr, pe) ((team_ptr)->start + ((team_ptr)->stride * (pe)))
 
 static inline int ishmemi_pe_in_active_set(int global_pe, int PE_start, int PE_stride, int PE_size)
 {
@@ -0,0 +1,61 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* Measures intra-node ishmem_alltoall bandwidth for teams of 2, 4, ... PEs, ending with n_pes.  Run
+ * once with ISHMEM_ALLTOALL_SCHEDULE=linear and once with ISHMEM_ALLTOALL_SCHEDULE=pairwise to
+ * compare the device alltoall schedules */
+
+#include <ishmem.h>
+
+static ishmem_team_t bench_team = ISHMEM_TEAM_INVALID;
+
+#define BW_TEST_HEADER ishmem_team_t team = bench_team;
+
+#define BW_TEST_FUNCTION                                                                           \
+    if (team != ISHMEM_TEAM_INVALID) {                                                             \
+        for (size_t i = 0; i < iterations; i += 1) {                                               \
+            ishmem_long_alltoall(team, (long *) dest, (long *) src, nelems);                       \
+        }                                                                                          \
+    }
+
+#define BW_TEST_FUNCTION_WORK_GROUP                                                                \
+    if (team != ISHMEM_TEAM_INVALID) {                                                             \
+        for (size_t i = 0; i < iterations; i += 1) {                                               \
+            ishmemx_long_alltoall_work_group(team, (long *) dest, (long *) src, nelems, grp);      \
+        }                                                                                          \
+    }
+#include "ishmem_tester.h"
+
+STUB_UNIT_TESTS
+
+int main(int argc, char **argv)
+{
+    class ishmem_tester t(argc, argv, true);
+    size_t bufsize = (t.max_nelems * (size_t) t.n_pes * sizeof(uint64_t)) + 4096;
+    t.alloc_memory(bufsize);
+    size_t errors = 0;
+    if (!t.test_types_set) t.add_test_type(LONG);
+    if (!t.test_ops_set) t.add_test_op(NOP);
+
+    for (int team_size = 2;; team_size <<= 1) {
+        if (team_size > t.n_pes) team_size = t.n_pes;
+        int ret = ishmem_team_split_strided(ISHMEM_TEAM_WORLD, 0, 1, team_size, NULL, 0,
+                                            &bench_team);
+        if (ret != 0) {
+            fprintf(stderr, "[%d] ishmem_team_split_strided failed for team size %d\n", t.my_pe,
+                    team_size);
+            errors += 1;
+            break;
+        }
+        if (t.my_pe == 0) printf("[%d] team size %d\n", t.my_pe, team_size);
+        t.run_bw_tests(team_size * team_size, true);
+        ishmem_sync_all();
+        if (bench_team != ISHMEM_TEAM_INVALID) ishmem_team_destroy(bench_team);
+        bench_team = ISHMEM_TEAM_INVALID;
+        if (team_size == t.n_pes) break;
+    }
+
+    ishmem_sync_all();
+    return (t.finalize_and_report(errors));
+}
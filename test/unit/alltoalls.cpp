@@ -0,0 +1,94 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Checks ishmem_alltoalls with non-unit strides from the device, the host, and a queue.  Only every
+ * DST'th element of dest is written, so the elements in between must be left untouched.
+ */
+
+#include <common.h>
+#include <vector>
+
+#define NELEMS 4
+#define SST    2
+#define DST    3
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *errors = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(errors);
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    *errors = 0;
+
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    size_t src_len = static_cast<size_t>(npes) * NELEMS * SST;
+    size_t dest_len = static_cast<size_t>(npes) * NELEMS * DST;
+
+    int *src = (int *) ishmem_malloc(src_len * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(dest_len * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    std::vector<int> host_src(src_len, -2);
+    for (int pe = 0; pe < npes; pe++) {
+        for (int j = 0; j < NELEMS; j++) {
+            host_src[(static_cast<size_t>(pe) * NELEMS + j) * SST] = my_pe * 1000 + pe * 100 + j;
+        }
+    }
+    q.memcpy(src, host_src.data(), src_len * sizeof(int)).wait_and_throw();
+
+    std::vector<int> host_dest(dest_len);
+    for (int mode = 0; mode < 3; mode++) {
+        q.fill(dest, -1, dest_len).wait_and_throw();
+        ishmem_barrier_all();
+
+        if (mode == 0) {
+            q.single_task([=]() {
+                 *ret = ishmem_int_alltoalls(dest, src, DST, SST, NELEMS);
+             }).wait_and_throw();
+        } else if (mode == 1) {
+            *ret = ishmem_int_alltoalls(dest, src, DST, SST, NELEMS);
+        } else {
+            ishmemx_int_alltoalls_on_queue(dest, src, DST, SST, NELEMS, ret, q).wait_and_throw();
+        }
+        if (*ret != 0) {
+            std::cerr << "[" << my_pe << "] alltoalls returned " << *ret << " in mode " << mode
+                      << std::endl;
+            *errors += 1;
+        }
+
+        q.memcpy(host_dest.data(), dest, dest_len * sizeof(int)).wait_and_throw();
+        for (size_t i = 0; i < dest_len; i++) {
+            int expected = -1;
+            if (i % DST == 0) {
+                int pe = static_cast<int>(i / DST / NELEMS);
+                int j = static_cast<int>(i / DST % NELEMS);
+                expected = pe * 1000 + my_pe * 100 + j;
+            }
+            if (host_dest[i] != expected) {
+                std::cerr << "[" << my_pe << "] dest[" << i << "] = " << host_dest[i]
+                          << " expected " << expected << " in mode " << mode << std::endl;
+                *errors += 1;
+                break;
+            }
+        }
+        ishmem_barrier_all();
+    }
+
+    if (*errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << *errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    sycl::free(errors, q);
+    ishmem_finalize();
+    return exit_code;
+}
@@ -0,0 +1,106 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Checks ishmemx_alltoallv from the device, the host, and a queue.  PE p sends
+ * (p + q) % MAX_BLOCK + 1 elements to PE q, so the block sizes differ between pairs of PEs, and the
+ * unused tail of each receive slot must be left untouched.
+ */
+
+#include <common.h>
+#include <vector>
+
+#define MAX_BLOCK 3
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *errors = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(errors);
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    *errors = 0;
+
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    size_t len = static_cast<size_t>(npes) * MAX_BLOCK;
+
+    int *src = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(dest);
+    size_t *offsets = (size_t *) ishmem_malloc(static_cast<size_t>(npes) * sizeof(size_t));
+    CHECK_ALLOC(offsets);
+    size_t *src_nelems = (size_t *) ishmem_malloc(static_cast<size_t>(npes) * sizeof(size_t));
+    CHECK_ALLOC(src_nelems);
+
+    /* The same offsets are used for src and dest, and are identical on every PE */
+    std::vector<int> host_src(len);
+    std::vector<size_t> host_offsets(static_cast<size_t>(npes));
+    std::vector<size_t> host_src_nelems(static_cast<size_t>(npes));
+    for (int pe = 0; pe < npes; pe++) {
+        host_offsets[pe] = static_cast<size_t>(pe) * MAX_BLOCK;
+        host_src_nelems[pe] = static_cast<size_t>((my_pe + pe) % MAX_BLOCK + 1);
+        for (int j = 0; j < MAX_BLOCK; j++) {
+            host_src[host_offsets[pe] + j] = my_pe * 1000 + pe * 100 + j;
+        }
+    }
+    q.memcpy(src, host_src.data(), len * sizeof(int)).wait_and_throw();
+    q.memcpy(offsets, host_offsets.data(), host_offsets.size() * sizeof(size_t)).wait_and_throw();
+    q.memcpy(src_nelems, host_src_nelems.data(), host_src_nelems.size() * sizeof(size_t))
+        .wait_and_throw();
+
+    std::vector<int> host_dest(len);
+    for (int mode = 0; mode < 3; mode++) {
+        q.fill(dest, -1, len).wait_and_throw();
+        ishmem_barrier_all();
+
+        if (mode == 0) {
+            q.single_task([=]() {
+                 *ret = ishmemx_int_alltoallv(dest, offsets, src, offsets, src_nelems);
+             }).wait_and_throw();
+        } else if (mode == 1) {
+            *ret = ishmemx_int_alltoallv(dest, offsets, src, offsets, src_nelems);
+        } else {
+            ishmemx_int_alltoallv_on_queue(dest, offsets, src, offsets, src_nelems, ret, q)
+                .wait_and_throw();
+        }
+        if (*ret != 0) {
+            std::cerr << "[" << my_pe << "] alltoallv returned " << *ret << " in mode " << mode
+                      << std::endl;
+            *errors += 1;
+        }
+
+        q.memcpy(host_dest.data(), dest, len * sizeof(int)).wait_and_throw();
+        for (int pe = 0; pe < npes; pe++) {
+            int count = (pe + my_pe) % MAX_BLOCK + 1;
+            for (int j = 0; j < MAX_BLOCK; j++) {
+                int expected = (j < count) ? pe * 1000 + my_pe * 100 + j : -1;
+                int actual = host_dest[static_cast<size_t>(pe) * MAX_BLOCK + j];
+                if (actual != expected) {
+                    std::cerr << "[" << my_pe << "] element " << j << " from PE " << pe << " is "
+                              << actual << " expected " << expected << " in mode " << mode
+                              << std::endl;
+                    *errors += 1;
+                }
+            }
+        }
+        ishmem_barrier_all();
+    }
+
+    if (*errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << *errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+
+    ishmem_free(src_nelems);
+    ishmem_free(offsets);
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    sycl::free(errors, q);
+    ishmem_finalize();
+    return exit_code;
+}
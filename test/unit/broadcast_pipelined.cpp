@@ -0,0 +1,97 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Runs host-initiated, single work-item, and work-group broadcasts on ISHMEM_TEAM_WORLD of at
+ * least ISHMEM_BROADCAST_PIPELINE_CUTOVER bytes, so that intra-node teams of three or more PEs use
+ * the pipelined chain broadcast, and checks that the destination of every PE, the root included,
+ * holds the root's source.
+ */
+
+#include <common.h>
+#include <vector>
+
+static int value(int pe, size_t idx)
+{
+    return (pe << 24) + static_cast<int>(idx & 0xffffff);
+}
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    int errors = 0;
+
+    setenv("ISHMEM_BROADCAST_PIPELINE_CUTOVER", "65536", 0);
+    setenv("ISHMEM_BROADCAST_PIPELINE_CHUNK_SIZE", "16384", 0);
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    if (npes < 3) {
+        if (my_pe == 0) std::cout << "Test requires 3 or more PEs" << std::endl;
+        sycl::free(ret, q);
+        ishmem_finalize();
+        return exit_code;
+    }
+
+    /* A partial last chunk is included */
+    size_t nelems = strtoul(getenv("ISHMEM_BROADCAST_PIPELINE_CUTOVER"), nullptr, 0) / sizeof(int);
+    nelems += 3;
+    int *src = (int *) ishmem_malloc(nelems * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(nelems * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    std::vector<int> host_src(nelems), host_dest(nelems), expected(nelems);
+    int root = npes - 1;
+    for (size_t i = 0; i < nelems; i++) {
+        host_src[i] = value(my_pe, i);
+        expected[i] = value(root, i);
+    }
+
+    const char *modes[3] = {"host", "single work-item", "work-group"};
+    for (int mode = 0; mode < 3; mode++) {
+        q.memcpy(src, host_src.data(), nelems * sizeof(int)).wait_and_throw();
+        q.fill(dest, -1, nelems).wait_and_throw();
+        ishmem_barrier_all();
+
+        if (mode == 0) {
+            *ret = ishmem_int_broadcast(ISHMEM_TEAM_WORLD, dest, src, nelems, root);
+        } else if (mode == 1) {
+            q.single_task([=]() {
+                 *ret = ishmem_int_broadcast(ISHMEM_TEAM_WORLD, dest, src, nelems, root);
+             }).wait_and_throw();
+        } else {
+            q.parallel_for(sycl::nd_range<1>{128, 128}, [=](sycl::nd_item<1> it) {
+                 auto grp = it.get_group();
+                 int r = ishmemx_int_broadcast_work_group(ISHMEM_TEAM_WORLD, dest, src, nelems,
+                                                          root, grp);
+                 if (grp.leader()) *ret = r;
+             }).wait_and_throw();
+        }
+        ishmem_barrier_all();
+
+        q.memcpy(host_dest.data(), dest, nelems * sizeof(int)).wait_and_throw();
+        if (*ret != 0 || host_dest != expected) {
+            std::cerr << "[" << my_pe << "] " << modes[mode] << " broadcast of " << nelems
+                      << " ints failed" << (my_pe == root ? " on the root" : "") << " (ret "
+                      << *ret << ")" << std::endl;
+            errors += 1;
+        }
+    }
+
+    if (errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    } else {
+        std::cout << "[" << my_pe << "] No errors" << std::endl;
+    }
+
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    ishmem_finalize();
+    return exit_code;
+}
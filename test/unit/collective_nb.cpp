@@ -0,0 +1,121 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Starts nonblocking broadcast, fcollect, alltoall, and sum reduction on ISHMEM_TEAM_WORLD from the
+ * device and from the host, completes them with ishmemx_coll_wait or by polling ishmemx_coll_test,
+ * and checks the results.
+ */
+
+#include <common.h>
+#include <vector>
+
+#define NELEMS 8
+
+static int value(int pe, int to_pe, int idx)
+{
+    return (pe << 16) + (to_pe << 8) + idx;
+}
+
+/* Starts the op'th nonblocking collective, from either the host or the device */
+static int start_nb(int op, int *dest, const int *src, int root, ishmemx_coll_handle_t *handle)
+{
+    switch (op) {
+        case 0:
+            return ishmemx_broadcast_nb(ISHMEM_TEAM_WORLD, dest, src, NELEMS, root, handle);
+        case 1:
+            return ishmemx_fcollect_nb(ISHMEM_TEAM_WORLD, dest, src, NELEMS, handle);
+        case 2:
+            return ishmemx_alltoall_nb(ISHMEM_TEAM_WORLD, dest, src, NELEMS, handle);
+        default:
+            return ishmemx_sum_reduce_nb(ISHMEM_TEAM_WORLD, dest, src, NELEMS, handle);
+    }
+}
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    int errors = 0;
+
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    size_t len = static_cast<size_t>(npes) * NELEMS;
+
+    int *src = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    std::vector<int> host_src(len), host_dest(len), expected(len);
+    for (size_t i = 0; i < len; i++) {
+        host_src[i] = value(my_pe, static_cast<int>(i / NELEMS), static_cast<int>(i % NELEMS));
+    }
+
+    const char *names[4] = {"broadcast", "fcollect", "alltoall", "sum_reduce"};
+    int root = npes - 1;
+    for (int op = 0; op < 4; op++) {
+        for (int mode = 0; mode < 3; mode++) {
+            q.memcpy(src, host_src.data(), len * sizeof(int)).wait_and_throw();
+            q.fill(dest, -1, len).wait_and_throw();
+            ishmem_barrier_all();
+
+            if (mode == 0) {
+                q.single_task([=]() {
+                     ishmemx_coll_handle_t handle;
+                     int start = start_nb(op, dest, src, root, &handle);
+                     int status = ishmemx_coll_wait(&handle);
+                     *ret = (start != 0) ? start : status;
+                 }).wait_and_throw();
+            } else {
+                ishmemx_coll_handle_t handle;
+                int start = start_nb(op, dest, src, root, &handle);
+                int status = 0;
+                if (mode == 1) {
+                    status = ishmemx_coll_wait(&handle);
+                } else {
+                    while (ishmemx_coll_test(&handle, &status) == 0) {
+                    }
+                }
+                *ret = (start != 0) ? start : status;
+                if (handle != ISHMEMX_COLL_HANDLE_NULL) *ret = -1;
+            }
+
+            std::fill(expected.begin(), expected.end(), -1);
+            for (int pe = 0; pe < npes; pe++) {
+                for (int j = 0; j < NELEMS; j++) {
+                    size_t i = static_cast<size_t>(pe) * NELEMS + j;
+                    if (op == 0 && pe == 0) expected[j] = value(root, 0, j);
+                    if (op == 1) expected[i] = value(pe, 0, j);
+                    if (op == 2) expected[i] = value(pe, my_pe, j);
+                    if (op == 3 && pe == 0) {
+                        expected[j] = 0;
+                        for (int from = 0; from < npes; from++) expected[j] += value(from, 0, j);
+                    }
+                }
+            }
+
+            q.memcpy(host_dest.data(), dest, len * sizeof(int)).wait_and_throw();
+            if (*ret != 0 || host_dest != expected) {
+                std::cerr << "[" << my_pe << "] nonblocking " << names[op] << " failed (mode "
+                          << mode << ", ret " << *ret << ")" << std::endl;
+                errors += 1;
+            }
+            ishmem_barrier_all();
+        }
+    }
+
+    if (errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    ishmem_finalize();
+    return exit_code;
+}
@@ -0,0 +1,110 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Creates one plan per planned collective on ISHMEM_TEAM_WORLD and executes each of them several
+ * times from the device, the host, and a queue, changing the source data between executions.
+ * Collect sends my_pe + 1 elements per PE, so its plan depends on the exchanged sizes.
+ */
+
+#include <common.h>
+#include <vector>
+
+#define NELEMS 8
+#define ITERS  4
+
+static int value(int pe, int to_pe, int idx, int iter)
+{
+    return (iter << 24) + (pe << 16) + (to_pe << 8) + idx;
+}
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    int errors = 0;
+
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    size_t len = static_cast<size_t>(npes) * NELEMS;
+
+    int *src = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    ishmemx_plan_t plans[4];
+    const char *names[4] = {"alltoall", "broadcast", "collect", "fcollect"};
+    int root = npes - 1;
+    int rc = ishmemx_alltoall_plan_create(ISHMEM_TEAM_WORLD, dest, src, NELEMS, &plans[0]);
+    rc |= ishmemx_broadcast_plan_create(ISHMEM_TEAM_WORLD, dest, src, NELEMS, root, &plans[1]);
+    rc |= ishmemx_collect_plan_create(ISHMEM_TEAM_WORLD, dest, src,
+                                      static_cast<size_t>(my_pe) + 1, &plans[2]);
+    rc |= ishmemx_fcollect_plan_create(ISHMEM_TEAM_WORLD, dest, src, NELEMS, &plans[3]);
+    if (rc != 0) {
+        std::cerr << "[" << my_pe << "] plan creation failed" << std::endl;
+        ishmem_finalize();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<int> host_src(len), host_dest(len), expected(len);
+    for (int op = 0; op < 4; op++) {
+        for (int iter = 0; iter < ITERS * 3; iter++) {
+            int mode = iter % 3;
+            for (size_t i = 0; i < len; i++) {
+                host_src[i] = value(my_pe, static_cast<int>(i / NELEMS),
+                                    static_cast<int>(i % NELEMS), iter);
+            }
+            q.memcpy(src, host_src.data(), len * sizeof(int)).wait_and_throw();
+            q.fill(dest, -1, len).wait_and_throw();
+            ishmem_barrier_all();
+
+            if (mode == 0) {
+                ishmemx_plan_t plan = plans[op];
+                q.single_task([=]() { *ret = ishmemx_plan_execute(plan); }).wait_and_throw();
+            } else if (mode == 1) {
+                *ret = ishmemx_plan_execute(plans[op]);
+            } else {
+                ishmemx_plan_execute_on_queue(plans[op], ret, q).wait_and_throw();
+            }
+
+            std::fill(expected.begin(), expected.end(), -1);
+            size_t pos = 0;
+            for (int pe = 0; pe < npes; pe++) {
+                for (int j = 0; j < NELEMS; j++) {
+                    size_t i = static_cast<size_t>(pe) * NELEMS + j;
+                    if (op == 0) expected[i] = value(pe, my_pe, j, iter);
+                    if (op == 1 && pe == 0) expected[j] = value(root, 0, j, iter);
+                    if (op == 2 && j <= pe) expected[pos++] = value(pe, 0, j, iter);
+                    if (op == 3) expected[i] = value(pe, 0, j, iter);
+                }
+            }
+
+            q.memcpy(host_dest.data(), dest, len * sizeof(int)).wait_and_throw();
+            if (*ret != 0 || host_dest != expected) {
+                std::cerr << "[" << my_pe << "] " << names[op] << " plan failed in iteration "
+                          << iter << " (mode " << mode << ", ret " << *ret << ")" << std::endl;
+                errors += 1;
+            }
+            ishmem_barrier_all();
+        }
+    }
+
+    for (int op = 0; op < 4; op++) {
+        if (ishmemx_plan_destroy(plans[op]) != 0) errors += 1;
+    }
+
+    if (errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    ishmem_finalize();
+    return exit_code;
+}
@@ -0,0 +1,71 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <common.h>
+
+#define ALLOC_SIZE 4096
+#define ALLOC_BUCKET 12 /* log2(ALLOC_SIZE) */
+
+using std::cerr, std::endl;
+
+int main()
+{
+    int exit_code = EXIT_SUCCESS;
+    ishmemx_heap_info_t before, during, after;
+
+    ishmem_init();
+    int my_pe = ishmem_my_pe();
+
+    if (ishmemx_heap_info(&before)) {
+        cerr << "[" << my_pe << "] ishmemx_heap_info failed" << endl;
+        ishmem_finalize();
+        return EXIT_FAILURE;
+    }
+
+    void *buffer = ishmem_malloc(ALLOC_SIZE);
+    if (buffer == nullptr) {
+        cerr << "[" << my_pe << "] ishmem_malloc failed" << endl;
+        ishmem_finalize();
+        return EXIT_FAILURE;
+    }
+
+    ishmemx_heap_info(&during);
+    ishmem_free(buffer);
+    ishmemx_heap_info(&after);
+
+    if (during.bytes_in_use < before.bytes_in_use + ALLOC_SIZE) {
+        cerr << "[" << my_pe << "] bytes_in_use " << during.bytes_in_use
+             << " did not grow by at least " << ALLOC_SIZE << endl;
+        exit_code = EXIT_FAILURE;
+    }
+    if (during.num_allocations != before.num_allocations + 1) {
+        cerr << "[" << my_pe << "] num_allocations " << during.num_allocations << " expected "
+             << before.num_allocations + 1 << endl;
+        exit_code = EXIT_FAILURE;
+    }
+    if (during.histogram[ALLOC_BUCKET] != before.histogram[ALLOC_BUCKET] + 1) {
+        cerr << "[" << my_pe << "] histogram bucket " << ALLOC_BUCKET << " was not updated"
+             << endl;
+        exit_code = EXIT_FAILURE;
+    }
+    if (during.peak_bytes_in_use < during.bytes_in_use) {
+        cerr << "[" << my_pe << "] peak_bytes_in_use is below bytes_in_use" << endl;
+        exit_code = EXIT_FAILURE;
+    }
+    if (during.largest_free_block > during.bytes_free ||
+        during.bytes_free + during.bytes_in_use > during.heap_size) {
+        cerr << "[" << my_pe << "] inconsistent free space accounting" << endl;
+        exit_code = EXIT_FAILURE;
+    }
+#ifdef ENABLE_DLMALLOC
+    if (after.bytes_in_use != before.bytes_in_use ||
+        after.num_allocations != before.num_allocations) {
+        cerr << "[" << my_pe << "] heap usage not restored after ishmem_free" << endl;
+        exit_code = EXIT_FAILURE;
+    }
+#endif
+
+    ishmem_finalize();
+    return exit_code;
+}
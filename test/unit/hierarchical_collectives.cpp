@@ -0,0 +1,165 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Runs device-initiated barrier, sync, sum reduction, broadcast, and fcollect on ISHMEM_TEAM_WORLD
+ * with ISHMEM_ENABLE_HIERARCHICAL_COLLECTIVES set, from a single work-item and from a work-group,
+ * and checks the results.  The hierarchical path only applies to jobs on several nodes with the
+ * same number of consecutive PEs on each, so the test passes trivially on any other layout.
+ */
+
+#include <common.h>
+#include <climits>
+#include <vector>
+
+#define NELEMS 64
+
+static int value(int pe, int idx)
+{
+    return (pe << 8) + idx;
+}
+
+/* Runs the op'th collective from a single work-item (grp1 false) or a work-group */
+static int run_op(sycl::queue &q, int op, bool grp1, int *dest, const int *src, int root, int *ret)
+{
+    if (grp1) {
+        q.parallel_for(sycl::nd_range<1>{128, 128}, [=](sycl::nd_item<1> it) {
+             auto grp = it.get_group();
+             int r = 0;
+             switch (op) {
+                 case 0:
+                     ishmemx_barrier_all_work_group(grp);
+                     break;
+                 case 1:
+                     ishmemx_sync_all_work_group(grp);
+                     break;
+                 case 2:
+                     r = ishmemx_int_sum_reduce_work_group(ISHMEM_TEAM_WORLD, dest, src, NELEMS,
+                                                           grp);
+                     break;
+                 case 3:
+                     r = ishmemx_int_broadcast_work_group(ISHMEM_TEAM_WORLD, dest, src, NELEMS,
+                                                          root, grp);
+                     break;
+                 default:
+                     r = ishmemx_int_fcollect_work_group(ISHMEM_TEAM_WORLD, dest, src, NELEMS, grp);
+                     break;
+             }
+             if (grp.leader()) *ret = r;
+         }).wait_and_throw();
+    } else {
+        q.single_task([=]() {
+             int r = 0;
+             switch (op) {
+                 case 0:
+                     ishmem_barrier_all();
+                     break;
+                 case 1:
+                     ishmem_sync_all();
+                     break;
+                 case 2:
+                     r = ishmem_int_sum_reduce(ISHMEM_TEAM_WORLD, dest, src, NELEMS);
+                     break;
+                 case 3:
+                     r = ishmem_int_broadcast(ISHMEM_TEAM_WORLD, dest, src, NELEMS, root);
+                     break;
+                 default:
+                     r = ishmem_int_fcollect(ISHMEM_TEAM_WORLD, dest, src, NELEMS);
+                     break;
+             }
+             *ret = r;
+         }).wait_and_throw();
+    }
+    return *ret;
+}
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    int errors = 0;
+
+    setenv("ISHMEM_ENABLE_HIERARCHICAL_COLLECTIVES", "1", 0);
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+
+    /* Every PE must agree on skipping, so vote on the layout across the world team */
+    int node_size = ishmem_team_n_pes(ISHMEMX_TEAM_NODE);
+    int node_start = ishmem_team_translate_pe(ISHMEMX_TEAM_NODE, 0, ISHMEM_TEAM_WORLD);
+    int *vote = (int *) ishmem_malloc(2 * sizeof(int));
+    CHECK_ALLOC(vote);
+    int layout[2] = {node_size, -node_size};
+    bool block = (node_size < npes) && (npes % node_size == 0) && (node_start % node_size == 0);
+    if (!block) layout[0] = layout[1] = INT_MAX;
+    q.memcpy(vote, layout, sizeof(layout)).wait_and_throw();
+    ishmem_barrier_all();
+    ishmem_int_max_reduce(ISHMEM_TEAM_WORLD, vote, vote, 2);
+    q.memcpy(layout, vote, sizeof(layout)).wait_and_throw();
+    if (layout[0] != node_size || layout[1] != -node_size) {
+        if (my_pe == 0) std::cout << "Test requires several nodes of equal size" << std::endl;
+        ishmem_free(vote);
+        sycl::free(ret, q);
+        ishmem_finalize();
+        return exit_code;
+    }
+
+    size_t len = static_cast<size_t>(npes) * NELEMS;
+    int *src = (int *) ishmem_malloc(NELEMS * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    std::vector<int> host_src(NELEMS), host_dest(len), expected(len);
+    for (int i = 0; i < NELEMS; i++)
+        host_src[i] = value(my_pe, i);
+
+    const char *names[5] = {"barrier_all", "sync_all", "sum_reduce", "broadcast", "fcollect"};
+    int root = npes - 1;
+    for (int op = 0; op < 5; op++) {
+        for (int grp1 = 0; grp1 < 2; grp1++) {
+            q.memcpy(src, host_src.data(), NELEMS * sizeof(int)).wait_and_throw();
+            q.fill(dest, -1, len).wait_and_throw();
+            ishmem_barrier_all();
+
+            int status = run_op(q, op, grp1, dest, src, root, ret);
+
+            std::fill(expected.begin(), expected.end(), -1);
+            for (int i = 0; i < NELEMS; i++) {
+                if (op == 2) {
+                    expected[i] = 0;
+                    for (int pe = 0; pe < npes; pe++)
+                        expected[i] += value(pe, i);
+                }
+                if (op == 3) expected[i] = value(root, i);
+                for (int pe = 0; op == 4 && pe < npes; pe++)
+                    expected[static_cast<size_t>(pe) * NELEMS + i] = value(pe, i);
+            }
+
+            q.memcpy(host_dest.data(), dest, len * sizeof(int)).wait_and_throw();
+            if (status != 0 || host_dest != expected) {
+                std::cerr << "[" << my_pe << "] hierarchical " << names[op] << " failed ("
+                          << (grp1 ? "work-group" : "single work-item") << ", ret " << status
+                          << ")" << std::endl;
+                errors += 1;
+            }
+            ishmem_barrier_all();
+        }
+    }
+
+    if (errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    } else {
+        std::cout << "[" << my_pe << "] No errors" << std::endl;
+    }
+
+    ishmem_free(dest);
+    ishmem_free(src);
+    ishmem_free(vote);
+    sycl::free(ret, q);
+    ishmem_finalize();
+    return exit_code;
+}
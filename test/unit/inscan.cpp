@@ -13,9 +13,17 @@
 #define TEST_BRANCH_ON_QUEUE(testname, typeenum, typename, type, op, opname)                       \
     ishmemx_##typename##_##testname##_on_queue((type *) dest, (type *) src, nelems, res, q);
 
+#define TEST_BRANCH_WORK_GROUP(testname, typeenum, typename, type, op, opname)                     \
+    *res = ishmemx_##typename##_##testname##_work_group(ISHMEM_TEAM_WORLD, (type *) dest,          \
+                                                        (type *) src, nelems, grp);
+
 GEN_HOST_FNS(sum_inscan, host, NOP, nop)
 GEN_ON_QUEUE_FNS(sum_inscan, on_queue, NOP, nop)
 GEN_SINGLE_FNS(sum_inscan, single, NOP, nop)
+GEN_SUBGROUP_FNS(sum_inscan, subgroup, NOP, nop)
+GEN_GRP1_FNS(sum_inscan, grp1, NOP, nop)
+GEN_GRP2_FNS(sum_inscan, grp2, NOP, nop)
+GEN_GRP3_FNS(sum_inscan, grp3, NOP, nop)
 
 class sum_inscan_tester : public ishmem_tester {
   public:
@@ -69,6 +77,10 @@ int main(int argc, char **argv)
     GEN_FN_TABLE(sum_inscan, host, NOP, nop)
     GEN_FN_TABLE(sum_inscan, on_queue, NOP, nop)
     GEN_FN_TABLE(sum_inscan, single, NOP, nop)
+    GEN_FN_TABLE(sum_inscan, subgroup, NOP, nop)
+    GEN_FN_TABLE(sum_inscan, grp1, NOP, nop)
+    GEN_FN_TABLE(sum_inscan, grp2, NOP, nop)
+    GEN_FN_TABLE(sum_inscan, grp3, NOP, nop)
 
     if (!t.test_types_set) t.add_test_type_list(scan_types);
     errors += t.run_aligned_tests(NOP);
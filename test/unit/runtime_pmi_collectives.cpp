@@ -0,0 +1,184 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Runs host-initiated sum and max reductions, broadcast, fcollect, collect, and alltoall, and a
+ * device-initiated sum reduction, on ISHMEM_TEAM_WORLD and on a team of the even PEs, with the PMI
+ * runtime and ISHMEM_ENABLE_GPU_IPC=0 unless set otherwise, so that every operation goes through
+ * the runtime.  Then checks test, wait_until, and signal_wait_until on ivars set from the device.
+ */
+
+#include <common.h>
+#include <algorithm>
+#include <vector>
+
+#define NELEMS 100
+
+static int value(int pe, int idx)
+{
+    return (pe << 10) + idx;
+}
+
+/* Runs every collective on the team and returns the number of mismatches */
+static int check_team(sycl::queue &q, ishmem_team_t team, int *src, int *dest, int *ret)
+{
+    int errors = 0;
+    int me = ishmem_team_my_pe(team);
+    int npes = ishmem_team_n_pes(team);
+    size_t len = static_cast<size_t>(npes) * NELEMS;
+    std::vector<int> host_src(len), host_dest(len), expected(len);
+    std::vector<int> world(npes);
+    for (int pe = 0; pe < npes; pe++)
+        world[pe] = ishmem_team_translate_pe(team, pe, ISHMEM_TEAM_WORLD);
+
+    for (size_t i = 0; i < len; i++)
+        host_src[i] = value(world[me], static_cast<int>(i));
+
+    for (int op = 0; op < 7; op++) {
+        const char *names[7] = {"sum_reduce", "max_reduce", "broadcast",     "fcollect",
+                                "collect",    "alltoall",   "device sum_reduce"};
+        int root = npes - 1;
+        size_t mine = static_cast<size_t>(me + 1) * NELEMS / npes;
+        int status = 0;
+
+        q.memcpy(src, host_src.data(), len * sizeof(int)).wait_and_throw();
+        q.fill(dest, -1, len).wait_and_throw();
+        ishmem_team_sync(team);
+
+        std::fill(expected.begin(), expected.end(), -1);
+        switch (op) {
+            case 0:
+            case 6:
+                if (op == 0) {
+                    status = ishmem_int_sum_reduce(team, dest, src, NELEMS);
+                } else {
+                    q.single_task([=]() {
+                         *ret = ishmem_int_sum_reduce(team, dest, src, NELEMS);
+                     }).wait_and_throw();
+                    status = *ret;
+                }
+                for (int i = 0; i < NELEMS; i++) {
+                    expected[i] = 0;
+                    for (int pe = 0; pe < npes; pe++)
+                        expected[i] += value(world[pe], i);
+                }
+                break;
+            case 1:
+                status = ishmem_int_max_reduce(team, dest, src, NELEMS);
+                for (int i = 0; i < NELEMS; i++)
+                    expected[i] = value(world[npes - 1], i);
+                break;
+            case 2:
+                status = ishmem_int_broadcast(team, dest, src, NELEMS, root);
+                for (int i = 0; i < NELEMS; i++)
+                    expected[i] = value(world[root], i);
+                break;
+            case 3:
+                status = ishmem_int_fcollect(team, dest, src, NELEMS);
+                for (int pe = 0; pe < npes; pe++)
+                    for (int i = 0; i < NELEMS; i++)
+                        expected[static_cast<size_t>(pe) * NELEMS + i] = value(world[pe], i);
+                break;
+            case 4: {
+                status = ishmem_int_collect(team, dest, src, mine);
+                size_t offset = 0;
+                for (int pe = 0; pe < npes; pe++) {
+                    size_t count = static_cast<size_t>(pe + 1) * NELEMS / npes;
+                    for (size_t i = 0; i < count; i++)
+                        expected[offset++] = value(world[pe], static_cast<int>(i));
+                }
+                break;
+            }
+            default:
+                status = ishmem_int_alltoall(team, dest, src, NELEMS / npes);
+                for (int pe = 0; pe < npes; pe++)
+                    for (int i = 0; i < NELEMS / npes; i++)
+                        expected[static_cast<size_t>(pe) * (NELEMS / npes) + i] =
+                            value(world[pe], me * (NELEMS / npes) + i);
+                break;
+        }
+        q.memcpy(host_dest.data(), dest, len * sizeof(int)).wait_and_throw();
+        if (status != 0 || host_dest != expected) {
+            std::cerr << "[" << ishmem_my_pe() << "] " << names[op] << " on a team of " << npes
+                      << " failed (ret " << status << ")" << std::endl;
+            errors += 1;
+        }
+        ishmem_team_sync(team);
+    }
+    return errors;
+}
+
+int main(void)
+{
+#if !defined(ENABLE_PMI)
+    std::cout << "Test requires the PMI runtime" << std::endl;
+    return EXIT_SUCCESS;
+#else
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *ret = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(ret);
+    int errors = 0;
+
+    setenv("ISHMEM_RUNTIME", "PMI", 0);
+    setenv("ISHMEM_ENABLE_GPU_IPC", "0", 0);
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+    size_t len = static_cast<size_t>(npes) * NELEMS;
+
+    int *src = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(src);
+    int *dest = (int *) ishmem_malloc(len * sizeof(int));
+    CHECK_ALLOC(dest);
+
+    errors += check_team(q, ISHMEM_TEAM_WORLD, src, dest, ret);
+
+    ishmem_team_t even_team;
+    ishmem_team_split_strided(ISHMEM_TEAM_WORLD, 0, 2, (npes + 1) / 2, NULL, 0, &even_team);
+    if (even_team != ISHMEM_TEAM_INVALID) {
+        errors += check_team(q, even_team, src, dest, ret);
+        ishmem_team_destroy(even_team);
+    }
+    ishmem_barrier_all();
+
+    /* Point-to-point synchronization on ivars of this PE */
+    long *ivar = (long *) ishmem_calloc(1, sizeof(long));
+    CHECK_ALLOC(ivar);
+    uint64_t *sig = (uint64_t *) ishmem_calloc(1, sizeof(uint64_t));
+    CHECK_ALLOC(sig);
+
+    if (ishmem_long_test(ivar, ISHMEM_CMP_EQ, 1) != 0) {
+        std::cerr << "[" << my_pe << "] test matched an unset ivar" << std::endl;
+        errors += 1;
+    }
+    q.single_task([=]() {
+         *ivar = 1;
+         *sig = 2;
+     }).wait_and_throw();
+    if (ishmem_long_test(ivar, ISHMEM_CMP_EQ, 1) != 1) {
+        std::cerr << "[" << my_pe << "] test missed a set ivar" << std::endl;
+        errors += 1;
+    }
+    ishmem_long_wait_until(ivar, ISHMEM_CMP_GE, 1);
+    if (ishmem_signal_wait_until(sig, ISHMEM_CMP_EQ, 2) != 2) {
+        std::cerr << "[" << my_pe << "] signal_wait_until returned a wrong value" << std::endl;
+        errors += 1;
+    }
+
+    if (errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    } else {
+        std::cout << "[" << my_pe << "] No errors" << std::endl;
+    }
+
+    ishmem_free(sig);
+    ishmem_free(ivar);
+    ishmem_free(dest);
+    ishmem_free(src);
+    sycl::free(ret, q);
+    ishmem_finalize();
+    return exit_code;
+#endif
+}
@@ -0,0 +1,86 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Repeatedly splits ISHMEMX_TEAM_NODE into the team of its even PEs, which is done without the
+ * runtime, then checks a device fcollect (intra-node) and a host reduction and sync (which go
+ * through the runtime and so create the runtime team on first use).
+ */
+
+#include <common.h>
+#include <stdio.h>
+
+#define N_SPLITS 64
+
+int main(void)
+{
+    int exit_code = EXIT_SUCCESS;
+    sycl::queue q;
+    int *errors = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(errors);
+    *errors = 0;
+
+    ishmem_init();
+
+    int my_pe = ishmem_my_pe();
+    int node_pe = ishmem_team_my_pe(ISHMEMX_TEAM_NODE);
+    int node_npes = ishmem_team_n_pes(ISHMEMX_TEAM_NODE);
+    int team_npes = (node_npes + 1) / 2;
+
+    int *src = (int *) ishmem_malloc(sizeof(int));
+    CHECK_ALLOC(src);
+    int *dst = (int *) ishmem_malloc(static_cast<size_t>(node_npes) * sizeof(int));
+    CHECK_ALLOC(dst);
+    int *sum = (int *) ishmem_malloc(sizeof(int));
+    CHECK_ALLOC(sum);
+
+    for (int iter = 0; iter < N_SPLITS; iter++) {
+        ishmem_team_t team;
+        int ret = ishmem_team_split_strided(ISHMEMX_TEAM_NODE, 0, 2, team_npes, NULL, 0, &team);
+        if (ret != 0) {
+            std::cerr << "[" << my_pe << "] ishmem_team_split_strided failed in iteration " << iter
+                      << std::endl;
+            exit_code = EXIT_FAILURE;
+            break;
+        }
+        if ((node_pe % 2 == 0) != (team != ISHMEM_TEAM_INVALID)) {
+            std::cerr << "[" << my_pe << "] wrong team membership in iteration " << iter
+                      << std::endl;
+            exit_code = EXIT_FAILURE;
+        }
+
+        if (team != ISHMEM_TEAM_INVALID) {
+            int team_pe = ishmem_team_my_pe(team);
+            q.single_task([=]() {
+                 *src = team_pe + iter;
+                 ishmem_int_fcollect(team, dst, src, 1);
+                 for (int i = 0; i < team_npes; i++) {
+                     if (dst[i] != i + iter) *errors += 1;
+                 }
+             }).wait_and_throw();
+
+            ishmem_int_sum_reduce(team, sum, src, 1);
+            int expected = (team_npes * (team_npes - 1)) / 2 + team_npes * iter;
+            int result = 0;
+            q.memcpy(&result, sum, sizeof(int)).wait_and_throw();
+            if (result != expected) {
+                std::cerr << "[" << my_pe << "] sum " << result << " expected " << expected
+                          << " in iteration " << iter << std::endl;
+                *errors += 1;
+            }
+            ishmem_team_sync(team);
+            ishmem_team_destroy(team);
+        }
+    }
+
+    if (*errors > 0) {
+        std::cerr << "[" << my_pe << "] Validation check(s) failed: " << *errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+
+    ishmem_free(sum);
+    ishmem_free(dst);
+    ishmem_free(src);
+    sycl::free(errors, q);
+    ishmem_finalize();
+    return exit_code;
+}
@@ -0,0 +1,115 @@
+/* Copyright (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Syncs a team of the even PEs from the host and from the device, with the dissemination algorithm
+ * unless ISHMEM_TEAM_SYNC_ALGORITHM is set, and checks that every member sees the value its
+ * neighbor stored before the sync.  Then splits the strided team and syncs the child the same way.
+ */
+
+#include <common.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ITERATIONS 16
+
+int main(void)
+{
+    sycl::queue q;
+    int *errors = sycl::malloc_host<int>(1, q);
+    CHECK_ALLOC(errors);
+    *errors = 0;
+
+    setenv("ISHMEM_TEAM_SYNC_ALGORITHM", "dissemination", 0);
+    ishmem_init();
+
+    int me = ishmem_my_pe();
+    int npes = ishmem_n_pes();
+
+    if (npes < 3) {
+        if (me == 0) printf("Test requires 3 or more PEs\n");
+        sycl::free(errors, q);
+        ishmem_finalize();
+        return 0;
+    }
+
+    int *slot = (int *) ishmem_malloc(sizeof(int));
+    CHECK_ALLOC(slot);
+    q.single_task([=]() { *slot = -1; }).wait_and_throw();
+    ishmem_barrier_all();
+
+    ishmem_team_t even_team;
+    int ret = ishmem_team_split_strided(ISHMEM_TEAM_WORLD, 0, 2, (npes + 1) / 2, NULL, 0,
+                                        &even_team);
+    if (ret != 0) {
+        fprintf(stderr, "[%d] ishmem_team_split_strided failed\n", me);
+        *errors += 1;
+    }
+
+    if (even_team != ISHMEM_TEAM_INVALID) {
+        int team_size = ishmem_team_n_pes(even_team);
+        int team_me = ishmem_team_my_pe(even_team);
+        int next = ishmem_team_translate_pe(even_team, (team_me + 1) % team_size,
+                                            ISHMEM_TEAM_WORLD);
+
+        /* Host-initiated */
+        for (int i = 0; i < ITERATIONS; i++) {
+            q.single_task([=]() { *slot = i; }).wait_and_throw();
+            ishmem_team_sync(even_team);
+            q.single_task([=]() { *errors += (ishmem_int_g(slot, next) != i); }).wait_and_throw();
+            ishmem_team_sync(even_team);
+        }
+        if (*errors > 0) fprintf(stderr, "[%d] host-initiated strided team sync failed\n", me);
+
+        /* Device-initiated */
+        int host_errors = *errors;
+        for (int i = 0; i < ITERATIONS; i++) {
+            int value = ITERATIONS + i;
+            q.single_task([=]() {
+                 *slot = value;
+                 ishmem_team_sync(even_team);
+                 *errors += (ishmem_int_g(slot, next) != value);
+                 ishmem_team_sync(even_team);
+             }).wait_and_throw();
+        }
+        if (*errors > host_errors)
+            fprintf(stderr, "[%d] device-initiated strided team sync failed\n", me);
+
+        /* Split of the strided team, which syncs it within the split */
+        ishmem_team_t child_team;
+        ret = ishmem_team_split_strided(even_team, 0, 2, (team_size + 1) / 2, NULL, 0,
+                                        &child_team);
+        if (ret != 0) {
+            fprintf(stderr, "[%d] ishmem_team_split_strided of the strided team failed\n", me);
+            *errors += 1;
+        }
+        if (child_team != ISHMEM_TEAM_INVALID) {
+            int child_next = ishmem_team_translate_pe(
+                child_team, (ishmem_team_my_pe(child_team) + 1) % ishmem_team_n_pes(child_team),
+                ISHMEM_TEAM_WORLD);
+            q.single_task([=]() { *slot = -2; }).wait_and_throw();
+            ishmem_team_sync(child_team);
+            q.single_task([=]() {
+                 *errors += (ishmem_int_g(slot, child_next) != -2);
+             }).wait_and_throw();
+            ishmem_team_sync(child_team);
+            ishmem_team_destroy(child_team);
+        }
+
+        ishmem_team_destroy(even_team);
+    }
+
+    ishmem_barrier_all();
+
+    int exit_code = EXIT_SUCCESS;
+    if (*errors > 0) {
+        std::cerr << "[ERROR] Validation check(s) failed: " << *errors << std::endl;
+        exit_code = EXIT_FAILURE;
+    } else {
+        std::cout << "[" << me << "] No errors" << std::endl;
+    }
+
+    ishmem_free(slot);
+    sycl::free(errors, q);
+    ishmem_finalize();
+    return exit_code;
+}